@@ -0,0 +1,48 @@
+/**
+ * @file DTMEngine.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class template to run a DTM specialized on its number of tapes.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <functional>
+#include <utility>
+
+#include "../structure/dispatchTable.hpp"
+#include "../structure/executionContext.hpp"
+
+/**
+ * @brief Type of the functions that run a DTM for a bounded number of steps. They receive the compiled transitions, the
+ *        execution context and the maximum number of steps to make, and return false if the DTM halted. Engines on
+ *        compressed tapes may return before making them, to bound the work of a call.
+ */
+using EngineRunner = std::function<bool(const DispatchTable&, ExecutionContext&, const std::uint64_t)>;
+
+/**
+ * @brief Class template to run a DTM with K tapes. The tapes are kept in a std::array and the packing of the read key
+ *        and the per-tape writes and movements are unrolled at compile time, so a step has no loop over the tapes.
+ *        DTMEngine<0> is the generic engine, which takes the number of tapes from the execution context. The other
+ *        engines apply the packed actions of the dispatch table when it has them (see DispatchTable::Action). Scans
+ *        and loops (see TransitionLoop) are applied at once, as many steps as they last.
+ * 
+ * @tparam K Number of tapes of the DTM, or 0 for any number of tapes.
+ */
+template <unsigned K>
+class DTMEngine {
+  public:
+    static bool Run(const DispatchTable&, ExecutionContext&, const std::uint64_t);
+  private:
+    template <bool MASKED>
+    static bool RunPacked(const DispatchTable&, ExecutionContext&, const std::uint64_t);
+    template <bool MASKED, std::size_t... I>
+    static std::uint64_t Key(const DispatchTable&, const unsigned, const std::array<Tape*, K>&, std::index_sequence<I...>);
+    static std::uint64_t Iterate(const TransitionLoop&, std::vector<Tape>&, const std::uint64_t);
+    template <std::size_t... I>
+    static void Apply(const CompiledTransition&, const std::array<Tape*, K>&, std::index_sequence<I...>);
+    template <std::size_t... I>
+    static void Apply(const DispatchTable&, const std::uint64_t, const std::array<Tape*, K>&, std::index_sequence<I...>);
+};
+
+EngineRunner SelectEngine(const unsigned);
@@ -0,0 +1,43 @@
+/**
+ * @file counterEngine.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to run a DTM keeping the tapes it uses as unary counters as integers.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include "../structure/dispatchTable.hpp"
+#include "../structure/executionContext.hpp"
+
+/**
+ * @brief Class to run a DTM whose tapes other than the first one may be used as unary counters, as the tapes 2 and 3 of
+ *        a machine that writes a marker per symbol read and then erases them while comparing. Those tapes are kept as
+ *        UnaryCounter objects and the rest as flat tapes.
+ *
+ *       - The counters are found before running (see FindCounters) by an abstract interpretation of the transitions
+ *         from the initial state, which tracks for every state where the head of a blank tape can be relative to its
+ *         block of markers: anywhere while it is empty, on its last marker or right past it. A tape is a counter if no
+ *         reachable transition can split the block, write a second marker or leave the head elsewhere.
+ *
+ *       - Increments, decrements and zero tests on counters take constant time, and so do the scans and loops (see
+ *         TransitionLoop) over them, so a loop comparing two counters runs in a single operation.
+ *
+ *       - At most CompiledMachine::CHECK_INTERVAL operations, and as many steps moving a flat tape, are made per call,
+ *         so the memory of the flat tapes is checked as often as with the specialized engine.
+ */
+class CounterEngine {
+  public:
+    static std::uint64_t FindCounters(const DispatchTable&, const unsigned, const unsigned);
+    static std::uint64_t Key(const DispatchTable&, const unsigned, const ExecutionContext&);
+    static bool Run(const DispatchTable&, ExecutionContext&, const std::uint64_t);
+  private:
+    static const unsigned EMPTY;
+    static const unsigned ON_LAST;
+    static const unsigned PAST_LAST;
+
+    static bool IsCounter(const DispatchTable&, const std::vector<std::vector<unsigned>>&, const unsigned, const unsigned,
+                          const Movement&);
+    static unsigned NextPlaces(const unsigned, const bool, const int);
+    static std::uint64_t Iterate(const TransitionLoop&, ExecutionContext&, const std::uint64_t);
+};
@@ -0,0 +1,22 @@
+/**
+ * @file engineKind.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the enum to represent the engines available to run a DTM.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+/**
+ * @brief Enum to represent the engines available to run a DTM.
+ */
+enum class EngineKind {
+  SPECIALIZED,
+  THREADED,
+  NATIVE,
+  JIT,
+  RUN_LENGTH,
+  MACRO,
+  HASHLIFE,
+  COUNTERS
+};
@@ -0,0 +1,45 @@
+/**
+ * @file hashlifeEngine.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to run a single-tape DTM over memoized segments of its tape, in the manner of Hashlife.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include "../structure/dispatchTable.hpp"
+#include "../structure/executionContext.hpp"
+
+/**
+ * @brief Class to run a single-tape DTM on a tree of hash-consed segments (see SegmentTape), applying in a single
+ *        operation the effect of running over a whole segment, as Hashlife does with the cells of Life.
+ *
+ *       - The effect of entering a segment by one side in a state is a segment step, memoized in the execution
+ *         context by state, segment and side. The step of a block is simulated cell by cell, and the step of a larger
+ *         segment is composed from the steps of its halves, so the steps of every scale share their memo and a sweep
+ *         over a regular segment takes a number of operations logarithmic in its length. The segments holding a cell
+ *         written since the last sweep are new, so their steps are composed again: a DTM that rewrites the ends of its
+ *         tape on every sweep still runs in time linear in its number of sweeps, with a hash lookup per level.
+ *
+ *       - When the head is on the border of a block, the engine applies the step of the largest segment that has the
+ *         head on the same border and fits in the remaining steps. Otherwise, or when no step fits, the DTM is run
+ *         cell by cell inside the block, so step counts are exact.
+ *
+ *       - A segment step is cut short, leaving the head inside the segment, after MAX_SUBSTEPS steps of its halves (or
+ *         cell steps for a block), or when a half is cut short, which bounds the cost of segments the DTM never leaves.
+ *
+ *       - Once the tape holds more than MAX_NODES segments, or the memo more steps, the segments the tape no longer
+ *         holds are dropped with the memo (see SegmentTape::Compact), so memory stays bounded on irregular runs.
+ */
+class HashlifeEngine {
+  public:
+    static const std::uint64_t MAX_SUBSTEPS;
+    static const std::size_t MAX_NODES;
+
+    static bool Run(const DispatchTable&, ExecutionContext&, const std::uint64_t);
+  private:
+    static const SegmentStep& Step(const DispatchTable&, SegmentTape&, std::unordered_map<std::uint64_t, SegmentStep>&, const StateId,
+                                   const std::uint32_t, const unsigned, const int);
+    static bool Fits(const SegmentStep&, const std::uint64_t);
+    static SegmentStep Simulate(const DispatchTable&, const SegmentTape&, const SymbolCode, const StateId, const unsigned, const std::uint64_t);
+};
@@ -0,0 +1,69 @@
+/**
+ * @file jitEngine.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to run a DTM compiled in process to x86-64 machine code.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <array>
+
+#include "../structure/dispatchTable.hpp"
+#include "../structure/executionContext.hpp"
+
+/**
+ * @brief Struct to represent a tape as seen by the machine code generated by the JIT: pointers to the cell under the
+ *        head, to the leftmost and rightmost visited cells and to the first and last cells of the buffer.
+ */
+struct JitTape {
+  unsigned char* head;
+  unsigned char* leftmost;
+  unsigned char* rightmost;
+  unsigned char* first;
+  unsigned char* last;
+};
+
+struct JitRun;
+
+/**
+ * @brief Class to run a DTM compiled to x86-64 machine code in an mmap'd executable region, without any external
+ *        compiler. The current state is the program counter: each state becomes a block with a compare/branch tree
+ *        over the symbols read, and each transition a straight sequence of byte stores and pointer increments ending
+ *        in a jump to the block of the next state. The head pointers and the remaining steps are kept in registers.
+ *
+ *       - Only x86-64 Unix platforms and DTMs of up to MAX_TAPES tapes and 256 tape symbols (so a cell is a byte) are
+ *         supported (see IsSupported); the other ones fall back to the interpreter.
+ */
+class JitEngine {
+  public:
+    static constexpr unsigned MAX_TAPES{8};
+
+    JitEngine(const DispatchTable&, const unsigned, const unsigned);
+    JitEngine(const JitEngine&) = delete;
+    JitEngine& operator=(const JitEngine&) = delete;
+    bool Run(const DispatchTable&, ExecutionContext&, const std::uint64_t) const;
+    ~JitEngine();
+
+    static bool IsSupported(const unsigned, const unsigned);
+  private:
+    static void Grow(JitRun*, unsigned);
+
+    void* code;
+    std::uint64_t size;
+    int (*function)(JitRun*);
+};
+
+/**
+ * @brief Struct to represent the arguments of the machine code generated by the JIT. The code runs from state until it
+ *        halts (returns 1) or makes maxSteps steps (returns 0), leaving the state reached and the steps made. When a
+ *        head reaches the first or the last cell of its tape, grow is called with the run and the index of the tape.
+ */
+struct JitRun {
+  std::array<JitTape, JitEngine::MAX_TAPES> tapes;
+  void (*grow)(JitRun*, unsigned);
+  void* host;
+  std::uint64_t maxSteps;
+  std::uint64_t steps;
+  unsigned state;
+};
@@ -0,0 +1,39 @@
+/**
+ * @file macroEngine.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to run a single-tape DTM as a macro machine over blocks of cells.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include "../structure/dispatchTable.hpp"
+#include "../structure/executionContext.hpp"
+
+/**
+ * @brief Class to run a single-tape DTM as a macro machine: the tape is a sequence of blocks of cells (see MacroTape)
+ *        and the DTM moves from block to block in macro steps.
+ *
+ *       - A macro step runs the DTM inside the block under the head until the head leaves the block or the DTM
+ *         halts. Macro steps are computed lazily and memoized in the execution context by state, block and entry side
+ *         (the head enters a block by its first or its last cell), so each one is simulated once per thread. The memo
+ *         is a table with a slot per state, block and side while it fits in MAX_DENSE_STEPS, and a hash table otherwise.
+ *
+ *       - A macro step that enters a block by one side and leaves it by the other in the same state is chained over
+ *         the whole run of equal blocks ahead in constant time.
+ *
+ *       - Step counts are exact: a macro step that does not fit in the remaining steps, or that starts from the middle
+ *         of a block, is simulated cell by cell without being memoized.
+ */
+class MacroEngine {
+  public:
+    static const unsigned MAX_DEFAULT_BLOCKS;
+    static const std::uint64_t MAX_DENSE_STEPS;
+
+    static unsigned DefaultBlockSize(const unsigned);
+    static std::uint64_t DenseSteps(const DispatchTable&, const MacroTape&);
+    static bool FitsBlocks(const unsigned, const unsigned);
+    static bool Run(const DispatchTable&, ExecutionContext&, const std::uint64_t);
+  private:
+    static MacroStep Simulate(const DispatchTable&, const MacroTape&, const StateId, const std::uint64_t);
+};
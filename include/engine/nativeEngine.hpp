@@ -0,0 +1,63 @@
+/**
+ * @file nativeEngine.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to run a DTM transpiled to C++ and compiled into a shared object.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <string>
+
+#include "../structure/dispatchTable.hpp"
+#include "../structure/executionContext.hpp"
+
+/**
+ * @brief Struct to represent the arguments of the function exported by a transpiled DTM. The function runs from state
+ *        until it halts (returns 1) or makes maxSteps steps (returns 0), leaving the state reached and the steps made.
+ *        When a head reaches the first or the last cell of its tape, grow is called with the host and the index of
+ *        the tape, and the view of that tape is reloaded.
+ */
+struct NativeRun {
+  RawTape* tapes;
+  void* host;
+  void (*grow)(void*, unsigned);
+  std::uint64_t maxSteps;
+  std::uint64_t steps;
+  unsigned state;
+};
+
+/**
+ * @brief Type of the function exported by a transpiled DTM.
+ */
+using NativeFunction = int (*)(NativeRun*);
+
+/**
+ * @brief Class to run a DTM transpiled to a C++ translation unit. Each state becomes a labeled block with a switch per
+ *        tape over the read symbols and each transition a straight sequence of writes, movements and a goto. The unit
+ *        is compiled with the local C++ compiler (CXX or g++) into a shared object, which is loaded with dlopen.
+ *
+ *       - Cells are addressed as bytes, or as 16-bit words for alphabets of more than 256 symbols.
+ *
+ *       - The generated source and the shared object are cached on disk, named after a hash of the source, so a
+ *         DTM is only compiled the first time it is run.
+ */
+class NativeEngine {
+  public:
+    static const std::string SYMBOL_NAME;
+
+    NativeEngine(const DispatchTable&, const unsigned, const unsigned, const std::string&);
+    NativeEngine(const NativeEngine&) = delete;
+    NativeEngine& operator=(const NativeEngine&) = delete;
+    bool Run(const DispatchTable&, ExecutionContext&, const std::uint64_t) const;
+    ~NativeEngine();
+
+    static std::string Transpile(const DispatchTable&, const unsigned, const unsigned);
+    static std::string DefaultCacheDirectory();
+  private:
+    static std::string Quote(const std::string&);
+    static void Grow(void*, unsigned);
+
+    void* library;
+    NativeFunction function;
+};
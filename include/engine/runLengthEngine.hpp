@@ -0,0 +1,32 @@
+/**
+ * @file runLengthEngine.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to run a DTM on run-length encoded tapes.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include "../structure/dispatchTable.hpp"
+#include "../structure/executionContext.hpp"
+
+/**
+ * @brief Class to run a DTM on run-length encoded tapes (see RunLengthTape), so machines that build and walk long
+ *        blocks of equal symbols, like unary counters, take time and memory proportional to the number of blocks.
+ *
+ *       - A transition is a sweep if it loops on its state, moves a single tape and keeps the symbols of the other
+ *         tapes. Then it applies again as long as the moved tape reads the same symbol, so the engine crosses the whole
+ *         run under the head in a single macro step, writing the symbol of the transition over it, and counts one
+ *         step per cell crossed.
+ *
+ *       - Any other transition is applied one step at a time.
+ */
+class RunLengthEngine {
+  public:
+    RunLengthEngine(const DispatchTable&);
+    bool Run(const DispatchTable&, ExecutionContext&, const std::uint64_t) const;
+  private:
+    static int SweepTape(const CompiledTransition&);
+
+    std::vector<int> sweepTapes;
+};
@@ -0,0 +1,49 @@
+/**
+ * @file threadedEngine.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to run a DTM lowered into threaded code.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include "../structure/dispatchTable.hpp"
+#include "../structure/executionContext.hpp"
+
+/**
+ * @brief Enum to represent the operations of the threaded code.
+ */
+enum class ThreadedOpcode : unsigned {
+  DISPATCH,
+  SCAN,
+  WRITE,
+  MOVE_LEFT,
+  MOVE_RIGHT,
+  JUMP
+};
+
+/**
+ * @brief Struct to represent an instruction of the threaded code: an operation and its operands.
+ */
+struct ThreadedInstruction {
+  ThreadedOpcode opcode;
+  unsigned tape;
+  unsigned operand;
+  SymbolCode symbol;
+};
+
+/**
+ * @brief Class to run a DTM lowered into threaded code. Each state becomes a block that starts with a DISPATCH on the
+ *        packed read key, and each transition becomes a straight sequence of the writes and movements it actually does
+ *        followed by a JUMP to the block of the next state. Instructions are dispatched with GCC's labels as values
+ *        when available and with a switch otherwise.
+ */
+class ThreadedEngine {
+  public:
+    ThreadedEngine(const DispatchTable&);
+    bool Run(const DispatchTable&, ExecutionContext&, const std::uint64_t) const;
+  private:
+    std::vector<ThreadedInstruction> code;
+    std::vector<unsigned> blocks;
+    std::vector<unsigned> entries;
+};
@@ -0,0 +1,72 @@
+/**
+ * @file x64Assembler.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to encode the x86-64 instructions emitted by the JIT engine.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Enum to represent the general purpose registers of x86-64, numbered as in their encoding.
+ */
+enum class Register : unsigned {
+  RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+  R8, R9, R10, R11, R12, R13, R14, R15
+};
+
+/**
+ * @brief Enum to represent the conditions of the jumps, valued as the second byte of their rel32 encoding.
+ */
+enum class Condition : unsigned char {
+  ALWAYS = 0x00,
+  BELOW = 0x82,
+  ABOVE_EQUAL = 0x83,
+  EQUAL = 0x84,
+  NOT_EQUAL = 0x85,
+  BELOW_EQUAL = 0x86,
+  ABOVE = 0x87
+};
+
+/**
+ * @brief Class to encode the small subset of x86-64 used by the JIT engine. Memory operands are always [base + disp32]
+ *        and jumps always take a rel32 to a label, which is patched once the code is finished.
+ */
+class X64Assembler {
+  public:
+    unsigned NewLabel();
+    void Bind(const unsigned);
+    void Jump(const Condition, const unsigned);
+    void Push(const Register);
+    void Pop(const Register);
+    void Move(const Register, const Register);
+    void Move(const Register, const std::uint32_t);
+    void Load(const Register, const Register, const std::int32_t);
+    void Load32(const Register, const Register, const std::int32_t);
+    void LoadByte(const Register, const Register, const std::int32_t);
+    void Store(const Register, const std::int32_t, const Register);
+    void Store32(const Register, const std::int32_t, const std::uint32_t);
+    void StoreByte(const Register, const std::int32_t, const std::uint8_t);
+    void Compare(const Register, const Register, const std::int32_t);
+    void Compare(const Register, const std::uint32_t);
+    void CompareAl(const std::uint8_t);
+    void Add(const Register, const std::int8_t);
+    void Subtract(const Register, const Register);
+    void Increment(const Register);
+    void Decrement(const Register);
+    void Call(const Register, const std::int32_t);
+    void Return();
+    std::vector<unsigned char> Code() const;
+  private:
+    void Rex(const bool, const unsigned, const unsigned);
+    void Operand(const unsigned, const Register, const std::int32_t);
+    void Immediate(const std::uint32_t);
+
+    std::vector<unsigned char> code;
+    std::vector<std::uint64_t> labels;
+    std::vector<std::pair<std::uint64_t, unsigned>> fixups;
+};
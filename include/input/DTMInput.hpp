@@ -31,9 +31,11 @@ using JSON = nlohmann::json;
  */
 class DTMInput {
   public:
+    static const Symbol WILDCARD;
+    static const Symbol KEEP;
+
     static DTM ReadDTM(const std::string&);
-    static void AddTransitions(std::map<std::string, State*>&, const std::vector<JSON>&, const Alphabet&, const unsigned);
+    static void AddTransitions(TransitionTable&, const JSON&, const StateArena&, const SymbolTable&, const Alphabet&, const unsigned);
   private:
     static std::string AlphabetFormatting(const Alphabet&);
-    static std::string StatesFormatting(const std::map<std::string, State*>&);
 };
@@ -0,0 +1,86 @@
+/**
+ * @file streamPipeline.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to evaluate a stream of input strings through a parallel pipeline.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../structure/DTM.hpp"
+#include "../utils/boundedQueue.hpp"
+
+/**
+ * @brief Enum to represent the formats of a stream of inputs: one input per line (a trailing carriage return is
+ *        dropped), or each input preceded by its length in decimal and a colon, so inputs may contain any byte.
+ *        Whitespace between length-prefixed inputs is ignored.
+ */
+enum class StreamFormat {
+  LINES,
+  LENGTH_PREFIXED
+};
+
+/**
+ * @brief Struct to represent the options of a stream: format of the inputs, whether to write the tapes after each
+ *        verdict and number of threads evaluating the inputs (0 for one per hardware thread).
+ */
+struct StreamOptions {
+  StreamFormat format{StreamFormat::LINES};
+  bool dumpTapes{false};
+  unsigned threads{0};
+};
+
+/**
+ * @brief Class to evaluate a stream of input strings with a DTM. The stream is read in chunks of CHUNK_SIZE bytes by
+ *        a reader thread, each chunk is evaluated as a batch on a work-stealing pool and the results are formatted and
+ *        written, in the order of the inputs, by a writer thread. The stages are connected by bounded queues, so the
+ *        memory used does not depend on the length of the stream.
+ *
+ *       - Each result is a line with the verdict (accepted, rejected, step-limit, memory-limit, loops or diverges),
+ *         a tab and the number of steps, optionally followed by the tapes.
+ *
+ *       - An input with symbols not found in the alphabet gets the verdict invalid after 0 steps, with no tapes, and
+ *         its error is written to the standard error with its number; the rest of the stream is still evaluated. A
+ *         malformed length prefix or an input longer than MAX_INPUT_LENGTH bytes stops the stream, after the results
+ *         of the inputs before it are written.
+ */
+class StreamPipeline {
+  public:
+    static const std::size_t CHUNK_SIZE;
+    static const std::size_t QUEUE_CAPACITY;
+    static const std::size_t MAX_INPUT_LENGTH;
+
+    StreamPipeline(DTM&, const RunLimits&, const StreamOptions&);
+    void Run(std::FILE*, std::FILE*);
+  private:
+    /**
+     * @brief Struct to represent a chunk of the stream: its bytes and the offset and length of every input in them.
+     */
+    struct Chunk {
+      std::string data;
+      std::vector<std::pair<std::size_t, std::size_t>> inputs;
+    };
+
+    /**
+     * @brief Struct to represent the results of a chunk, ready to be written, with the message of the error of every
+     *        input (empty if it was run).
+     */
+    struct Output {
+      std::vector<RunResult> results;
+      std::vector<std::string> tapes;
+      std::vector<std::string> errors;
+    };
+
+    void Read(std::FILE*, BoundedQueue<Chunk>&) const;
+    void Write(std::FILE*, BoundedQueue<Output>&) const;
+    std::size_t Split(Chunk&, const bool, std::size_t&) const;
+
+    DTM& dtm;
+    RunLimits limits;
+    StreamOptions options;
+};
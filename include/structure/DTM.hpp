@@ -7,16 +7,11 @@
 
 #pragma once
 
-#include <set>
-#include <numeric>
+#include <memory>
+#include <string_view>
 
-#include "state.hpp"
-#include "tape.hpp"
-
-/**
- * @brief Type to represent the alphabet of the stack of a DTM.
- */
-using Alphabet = std::set<Symbol>;
+#include "compiledMachine.hpp"
+#include "../utils/workStealingPool.hpp"
 
 /**
  * @brief Class to represent a deterministic Turing Machine (DTM). The implemented DTM has the following characteristics:
@@ -28,19 +23,31 @@ using Alphabet = std::set<Symbol>;
  *       - The DTM may not move on a transition (represented by the symbol 'S').
  * 
  *       - It has a virtual infinite tape to both sides.
+ *
+ *       - Its definition is compiled into a CompiledMachine, which can be shared with other threads (see Machine),
+ *         while the DTM keeps the workspace of the calling thread and of the workers of its batches.
  */
 class DTM {
   public:
-    DTM(const std::vector<State*>&, const Alphabet&, const Alphabet&, State*, const Symbol&, const unsigned);
+    DTM(const StateArena&, const TransitionTable&, const Alphabet&, const SymbolTable&, const StateId, const unsigned, const std::string&);
     bool Accepts(const std::string&);
+    RunResult Run(const std::string&, const RunLimits&);
+    std::vector<bool> AcceptsBatch(const std::vector<std::string_view>&, WorkStealingPool&);
+    std::vector<RunResult> RunBatch(const std::vector<std::string_view>&, const RunLimits&, WorkStealingPool&);
+    std::vector<RunResult> RunBatch(const std::vector<std::string_view>&, const RunLimits&, WorkStealingPool&, std::vector<std::string>&);
+    std::vector<RunResult> RunBatch(const std::vector<std::string_view>&, const RunLimits&, WorkStealingPool&, std::vector<std::string>*, std::vector<std::string>&);
+    void SetEngine(const EngineKind);
+    void SetEngine(const EngineKind, const std::string&);
+    void SetEngine(const EngineKind, const std::string&, const unsigned);
+    std::shared_ptr<const CompiledMachine> Machine() const;
     std::string TapesToString() const;
-    ~DTM();
   private:
-    std::vector<State*> states;
-    Alphabet alphabet;
-    Alphabet tapeAlphabet;
-    State* initialState;
-    Symbol blankSymbol;
-    unsigned numberOfTapes; 
-    std::vector<Tape> tapes;
+    std::vector<RunResult> Evaluate(const std::vector<std::string_view>&, const RunLimits&, WorkStealingPool&, std::vector<std::string>*, std::vector<std::string>*);
+    std::string TapesToString(const ExecutionContext&) const;
+    template <typename T>
+    std::string TapesToString(const std::vector<T>&) const;
+
+    std::shared_ptr<const CompiledMachine> machine;
+    RunWorkspace workspace;
+    std::vector<RunWorkspace> batchWorkspaces;
 };
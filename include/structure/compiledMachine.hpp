@@ -0,0 +1,74 @@
+/**
+ * @file compiledMachine.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to represent a DTM compiled for execution.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <memory>
+#include <numeric>
+#include <string_view>
+
+#include "tape.hpp"
+#include "tokenizer.hpp"
+#include "dispatchTable.hpp"
+#include "executionContext.hpp"
+#include "cycleDetector.hpp"
+#include "sweepDetector.hpp"
+#include "runResult.hpp"
+#include "../engine/DTMEngine.hpp"
+#include "../engine/threadedEngine.hpp"
+#include "../engine/nativeEngine.hpp"
+#include "../engine/jitEngine.hpp"
+#include "../engine/runLengthEngine.hpp"
+#include "../engine/macroEngine.hpp"
+#include "../engine/hashlifeEngine.hpp"
+#include "../engine/counterEngine.hpp"
+#include "../engine/engineKind.hpp"
+
+/**
+ * @brief Struct to represent the mutable state a thread needs to run a DTM: the execution context and the detectors of
+ *        non-halting runs. A workspace can be reused for any number of runs of the same machine, keeping its buffers.
+ */
+struct RunWorkspace {
+  ExecutionContext context;
+  CycleDetector cycleDetector;
+  SweepDetector sweepDetector;
+};
+
+/**
+ * @brief Class to represent the immutable part of a DTM: the symbol table of its tape alphabet, the tokenizer of its
+ *        inputs, its compiled transitions and the engine that runs them. Every member function is const and every run
+ *        writes only to the workspace it is given, so a machine can be shared (usually through a
+ *        std::shared_ptr<const CompiledMachine>) by any number of threads without locking.
+ */
+class CompiledMachine {
+  public:
+    static const std::uint64_t CHECK_INTERVAL;
+
+    CompiledMachine(const StateArena&, const TransitionTable&, const Alphabet&, const SymbolTable&, const StateId, const unsigned,
+                    const std::string&);
+    RunResult Run(const std::string_view, const RunLimits&, RunWorkspace&) const;
+    std::shared_ptr<const CompiledMachine> WithEngine(const EngineKind, const std::string&, const unsigned) const;
+    RunWorkspace NewWorkspace() const;
+    const SymbolTable& Symbols() const;
+  private:
+    void Load(const std::string_view, const TapeLayout, ExecutionContext&) const;
+    bool Monitor(const RunLimits&, const std::uint64_t, RunWorkspace&) const;
+    bool IsHalted(const ExecutionContext&) const;
+    std::uint64_t MemoryUsage(const ExecutionContext&) const;
+    RunResult Result(const HaltReason, const ExecutionContext&) const;
+
+    SymbolTable symbols;
+    Tokenizer tokenizer;
+    unsigned numberOfTapes;
+    DispatchTable dispatchTable;
+    StateId initialStateIndex;
+    EngineRunner engine;
+    unsigned cellBits;
+    TapeLayout layout;
+    unsigned blockSize;
+    std::uint64_t counterMask;
+};
@@ -0,0 +1,46 @@
+/**
+ * @file cycleDetector.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to detect DTM runs that repeat a configuration.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include "dispatchTable.hpp"
+#include "executionContext.hpp"
+
+/**
+ * @brief Class to detect repeated configurations (state, content of every tape and position of every head) of a DTM
+ *        run made step by step. A deterministic run that repeats a configuration loops forever.
+ *
+ *       - The configuration is hashed Zobrist-style: the hash is the XOR of a pseudo-random value per state, per head
+ *         position and per non-blank symbol at each position, so every write and movement updates it in O(1).
+ *
+ *       - Repetitions are searched with Brent's algorithm: a configuration is saved every time the number of steps
+ *         since the last save reaches a power of two, and every step is compared against it. A hash match is checked
+ *         against the saved configuration, so the verdict is exact. Only one configuration is saved at a time.
+ */
+class CycleDetector {
+  public:
+    CycleDetector();
+    void Reset(const ExecutionContext&);
+    void Update(const CompiledTransition&, const ExecutionContext&);
+    bool Check(const ExecutionContext&);
+    bool Looping() const;
+  private:
+    static std::uint64_t Mix(std::uint64_t);
+    static std::uint64_t StateHash(const unsigned);
+    static std::uint64_t HeadHash(const unsigned, const std::int64_t);
+    static std::uint64_t CellHash(const unsigned, const std::int64_t, const SymbolCode);
+    void Save(const ExecutionContext&);
+    bool Matches(const ExecutionContext&) const;
+
+    std::uint64_t hash;
+    std::uint64_t power;
+    std::uint64_t distance;
+    bool looping;
+    std::uint64_t savedHash;
+    unsigned savedState;
+    std::vector<Tape> savedTapes;
+};
@@ -0,0 +1,136 @@
+/**
+ * @file dispatchTable.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to represent the compiled transition function of a DTM.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "stateArena.hpp"
+#include "transitionTable.hpp"
+#include "tape.hpp"
+#include "runLengthTape.hpp"
+
+/**
+ * @brief Type to represent a transition once compiled: codes of the symbols read and of the symbols to write, movements
+ *        to make and indexes of the next state and of the state it belongs to. On the tapes its state does not read (see
+ *        DispatchTable::ReadMask), the code read is SymbolTable::ANY, and so is the code written if the cell is kept.
+ *        Transitions that loop on their state rewriting what they read and moving a single tape are scans: they
+ *        repeat while that tape reads one of scanSymbols, so the head can jump straight over those cells. Other
+ *        transitions may start a loop (see TransitionLoop), the index of which is loop. Transitions expanded from a
+ *        wildcard read have expanded set (see DispatchTable::WildcardRow).
+ */
+struct CompiledTransition {
+  std::vector<SymbolCode> readSymbols;
+  std::vector<SymbolCode> writeSymbols;
+  std::vector<Movement> movements;
+  StateId nextState;
+  StateId fromState;
+  int scanTape{-1};
+  std::vector<SymbolCode> scanSymbols{};
+  int loop{-1};
+  bool expanded{false};
+};
+
+/**
+ * @brief Type to represent a cycle of transitions that repeats while the tapes hold a periodic pattern: every tape
+ *        moves in the same direction in all of them (or stays), and the tapes that stay hold a symbol the cycle does
+ *        not change. Step k of the loop applies the transition of phase k % period, in state states[k % period], and
+ *        reads readSymbols[tape][k % period] (SymbolTable::ANY if the state does not read the tape) in the k-th cell
+ *        from the head of every moving tape, where it writes writeSymbols[tape][k % period] (SymbolTable::ANY if the
+ *        cell is kept). The number of steps the loop makes is thus the length of the shortest match of the patterns,
+ *        and its effect is a fill of the moving tapes and one jump of their heads (see Tape::Match and Tape::Fill).
+ */
+struct TransitionLoop {
+  std::vector<StateId> states;
+  std::vector<Movement> movements;
+  std::vector<std::vector<SymbolCode>> readSymbols;
+  std::vector<std::vector<SymbolCode>> writeSymbols;
+};
+
+/**
+ * @brief Class to represent the transition function of a DTM compiled into a direct-indexed table. Every state is
+ *        identified by its id (see StateArena) and every tuple of read symbols is packed into an integer key (one
+ *        digit in base |Γ| per tape, the code of the symbol in the symbol table), so finding the transition of a
+ *        configuration is a single array access.
+ *
+ *       - The table is dense (one slot per state and key) while it fits in MAX_DENSE_SLOTS; otherwise only the
+ *         defined transitions are stored in a hash table.
+ *
+ *       - Slots without a transition hold the HALT sentinel.
+ *
+ *       - The transitions with wildcard reads on the tapes their state reads are also kept unexpanded, as wildcard
+ *         rows in the order they take precedence, so code generators can test them one after another instead of
+ *         emitting one case per combination of symbols (see WildcardRow).
+ *
+ *       - Cycles of up to MAX_LOOP_PERIOD transitions that move the tapes uniformly are found when compiling, so
+ *         the interpreter can make all the iterations of such a loop at once (see TransitionLoop).
+ *
+ *       - When they fit in 64 bits, the actions of the transitions (a flag for scans and loops, the code written and a
+ *         2-bit movement per tape, and the next state) are also packed into words and interned, so transitions with
+ *         the same action share a word (see Action). The interpreter then reads a slot's 4-byte action index and a
+ *         shared word instead of a CompiledTransition and the vectors behind it, which keeps large multi-tape
+ *         machines in cache.
+ */
+class DispatchTable {
+  public:
+    static const unsigned HALT;
+    static const std::uint64_t MAX_DENSE_SLOTS;
+    static const unsigned MAX_LOOP_PERIOD;
+    static const unsigned MAX_LOOP_SEARCH;
+
+    DispatchTable(const StateArena&, const TransitionTable&, const SymbolTable&, const unsigned);
+    std::uint64_t Key(const unsigned, const std::vector<Tape>&) const;
+    std::uint64_t Key(const unsigned, const std::vector<RunLengthTape>&) const;
+    std::uint64_t Key(const std::vector<SymbolCode>&) const;
+    std::uint64_t Extend(const std::uint64_t, const SymbolCode) const;
+    std::uint64_t ReadMask(const unsigned) const;
+    bool ReadsAllTapes() const;
+    unsigned Lookup(const unsigned, const std::uint64_t) const;
+    const CompiledTransition& Transition(const unsigned) const;
+    const TransitionLoop& Loop(const unsigned) const;
+    unsigned NumberOfLoops() const;
+    unsigned NumberOfTransitions() const;
+    unsigned NumberOfStates() const;
+    unsigned WildcardRowsBegin(const unsigned) const;
+    unsigned WildcardRowsEnd(const unsigned) const;
+    const CompiledTransition& WildcardRow(const unsigned) const;
+    bool IsFinal(const unsigned) const;
+    bool HasPackedActions() const;
+    std::uint64_t Action(const unsigned) const;
+    unsigned NumberOfActions() const;
+    SymbolCode WriteSymbol(const std::uint64_t, const unsigned) const;
+    bool Writes(const std::uint64_t, const unsigned) const;
+    Movement MovementOf(const std::uint64_t, const unsigned) const;
+    StateId NextState(const std::uint64_t) const;
+    static bool IsSummarized(const std::uint64_t);
+  private:
+    static int ScanTape(const unsigned, const CompiledTransition&);
+    static bool Continues(const CompiledTransition&, const CompiledTransition&);
+    bool FollowLoop(std::vector<unsigned>&, const std::vector<std::vector<unsigned>>&, unsigned&) const;
+    void AddLoop(const std::vector<unsigned>&);
+    static unsigned BitsFor(const std::uint64_t);
+    void Expand(const StateId, const TransitionTable&, const unsigned, const unsigned, const bool);
+    void PackActions(const unsigned);
+
+    std::uint64_t keySpace;
+    std::vector<unsigned> denseSlots;
+    std::unordered_map<std::uint64_t, unsigned> sparseSlots;
+    std::vector<CompiledTransition> transitions;
+    std::vector<TransitionLoop> loops;
+    std::vector<CompiledTransition> wildcardRows;
+    std::vector<unsigned> wildcardRowOffsets;
+    std::vector<bool> finalStates;
+    std::vector<std::uint64_t> readMasks;
+    bool readsAllTapes;
+    unsigned radix;
+    std::vector<std::uint64_t> actions;
+    std::vector<unsigned> slotActions;
+    unsigned fieldBits;
+    unsigned stateShift;
+    SymbolCode symbolMask;
+};
@@ -0,0 +1,55 @@
+/**
+ * @file executionContext.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the struct to represent the mutable state of a DTM run.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "tape.hpp"
+#include "runLengthTape.hpp"
+#include "macroTape.hpp"
+#include "segmentTape.hpp"
+#include "unaryCounter.hpp"
+
+/**
+ * @brief Enum to represent the tapes that hold the configuration of a run: flat tapes, run-length tapes, a macro tape, a
+ *        segment tape or flat tapes and counters.
+ */
+enum class TapeLayout {
+  FLAT,
+  RUN_LENGTH,
+  MACRO,
+  SEGMENTS,
+  COUNTERS
+};
+
+/**
+ * @brief Struct to represent the mutable state of a DTM run: current state, steps made, tapes (with their heads) and the
+ *        views of the tapes handed to generated code. Runs on the run-length engine keep the tapes in runTapes instead
+ *        and runs on the macro engine in macroTapes, with the macro steps computed so far in denseMacroSteps or
+ *        sparseMacroSteps, and runs on the Hashlife engine in segmentTapes, with the segment steps computed so far in
+ *        segmentSteps. Runs on the counter engine keep the tapes of counterMask in counters and the rest in tapes;
+ *        layout tells which tapes hold the configuration. Every buffer is kept between runs, so once the tapes have
+ *        grown to the size needed by the inputs a step does not allocate memory.
+ */
+struct ExecutionContext {
+  unsigned state;
+  std::uint64_t steps;
+  std::vector<Tape> tapes;
+  std::vector<RunLengthTape> runTapes;
+  std::vector<MacroTape> macroTapes;
+  std::vector<MacroStep> denseMacroSteps;
+  std::unordered_map<std::uint64_t, MacroStep> sparseMacroSteps;
+  std::vector<SegmentTape> segmentTapes;
+  std::unordered_map<std::uint64_t, SegmentStep> segmentSteps;
+  std::vector<UnaryCounter> counters;
+  std::uint64_t counterMask{0};
+  TapeLayout layout{TapeLayout::FLAT};
+  std::vector<SymbolCode> input;
+  std::vector<RawTape> rawTapes;
+};
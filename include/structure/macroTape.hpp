@@ -0,0 +1,66 @@
+/**
+ * @file macroTape.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to represent a tape of a Turing Machine as a sequence of blocks of cells.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include "runLengthTape.hpp"
+#include "state.hpp"
+
+/**
+ * @brief Struct to represent the effect of running a DTM inside a block from a state and a head offset: the contents
+ *        left in the block, the state reached, the offset of the head (-1 or the block size if it left the block),
+ *        the steps made, the lowest and highest offsets visited and whether the DTM halted inside the block. A step
+ *        with no steps made that did not halt has not been computed yet.
+ */
+struct MacroStep {
+  SymbolCode block{0};
+  StateId state{0};
+  int offset{0};
+  std::uint64_t steps{0};
+  int lowest{0};
+  int highest{0};
+  bool halted{false};
+};
+
+/**
+ * @brief Class to represent a tape as a sequence of blocks of blockSize consecutive cells, each one a macro symbol:
+ *        the number whose digits in base radix (the number of symbols of the tape alphabet) are the codes of its
+ *        cells, the first cell the least significant digit. The all-blank block is 0.
+ *
+ *       - The blocks are stored in a RunLengthTape, so a run of equal blocks takes constant memory and a macro step
+ *         that leaves a block through the side opposite to the one it entered, in the same state, can be chained
+ *         over the whole run (see Chain).
+ *
+ *       - The head is a block and an offset inside it. Blocks start at multiples of blockSize from the first cell
+ *         of the input.
+ */
+class MacroTape {
+  public:
+    MacroTape(const unsigned, const unsigned);
+    SymbolCode Read() const;
+    SymbolCode Block() const;
+    unsigned Offset() const;
+    unsigned BlockSize() const;
+    std::uint64_t NumberOfBlocks() const;
+    SymbolCode Digit(const SymbolCode, const unsigned) const;
+    SymbolCode WithDigit(const SymbolCode, const unsigned, const SymbolCode) const;
+    void Apply(const MacroStep&);
+    std::uint64_t Chain(const MacroStep&, const std::uint64_t);
+    void InsertSymbols(const std::vector<SymbolCode>&);
+    std::uint64_t Extent() const;
+    std::uint64_t MemoryUsage() const;
+    const std::string ToString(const SymbolTable&) const;
+  private:
+    RunLengthTape blocks;
+    unsigned blockSize;
+    unsigned radix;
+    std::vector<SymbolCode> powers;
+    std::int64_t block;
+    unsigned offset;
+    std::int64_t leftmost;
+    std::int64_t rightmost;
+};
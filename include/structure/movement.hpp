@@ -10,7 +10,7 @@
 /**
  * @brief Enum to represent the possible movements of a DTM.
  */
-enum class Movement {
+enum class Movement : char {
   LEFT = 'L',
   RIGHT = 'R',
   STAY = 'S'
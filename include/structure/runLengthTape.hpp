@@ -0,0 +1,61 @@
+/**
+ * @file runLengthTape.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to represent a tape of a Turing Machine stored as runs of equal symbols.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "symbolTable.hpp"
+#include "movement.hpp"
+
+/**
+ * @brief Struct to represent a maximal block of consecutive cells holding the same symbol.
+ */
+struct SymbolRun {
+  SymbolCode symbol;
+  std::uint64_t length;
+};
+
+/**
+ * @brief Class to represent a tape of a Turing Machine as a sequence of runs of equal symbols, so a block of n equal
+ *        cells takes constant memory and can be crossed in a single operation (see Cross).
+ *
+ *       - The runs are split at the head into two stacks: the runs at the left of the head, the nearest last, and the
+ *         runs from the head on, the one holding the head last. Every step only touches the tops of the stacks.
+ *
+ *       - Adjacent runs of a stack never hold the same symbol, and the blank cells beyond the last run of a stack are
+ *         not stored, so walking into blank tape does not allocate memory.
+ */
+class RunLengthTape {
+  public:
+    RunLengthTape();
+    void Write(const SymbolCode);
+    SymbolCode Read() const;
+    void MoveHead(const Movement&);
+    std::uint64_t Cross(const Movement&, const SymbolCode, const std::uint64_t);
+    void Reset();
+    void InsertSymbols(const std::vector<SymbolCode>&);
+    std::uint64_t Extent() const;
+    std::uint64_t MemoryUsage() const;
+    std::size_t NumberOfRuns() const;
+    std::vector<SymbolRun> Runs() const;
+    std::int64_t Start() const;
+    const std::string ToString(const SymbolTable&) const;
+    static std::string Format(const std::vector<SymbolRun>&, const std::int64_t, const std::int64_t, const SymbolTable&);
+  private:
+    static void Push(std::vector<SymbolRun>&, const SymbolCode, const std::uint64_t);
+    static void Pop(std::vector<SymbolRun>&, const std::uint64_t);
+
+    std::vector<SymbolRun> left;
+    std::vector<SymbolRun> right;
+    std::int64_t position;
+    std::int64_t leftmost;
+    std::int64_t rightmost;
+};
@@ -0,0 +1,46 @@
+/**
+ * @file runResult.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the types to bound a DTM run and to describe how it ended.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * @brief Enum to represent the reason why a DTM run ended.
+ */
+enum class HaltReason {
+  ACCEPTED,
+  REJECTED,
+  STEP_LIMIT,
+  MEMORY_LIMIT,
+  LOOPING,
+  DIVERGING
+};
+
+/**
+ * @brief Struct to represent the budgets of a DTM run: maximum number of steps and maximum memory used by the tapes
+ *        in bytes, both unlimited by default, and whether to stop runs that repeat a configuration or that sweep into
+ *        blank tape in a translated cycle (both off by default).
+ */
+struct RunLimits {
+  std::uint64_t maxSteps{std::numeric_limits<std::uint64_t>::max()};
+  std::uint64_t maxMemory{std::numeric_limits<std::uint64_t>::max()};
+  bool detectCycles{false};
+  bool detectDivergence{false};
+};
+
+/**
+ * @brief Struct to represent the result of a DTM run: why it ended, the number of steps made and the maximum extent
+ *        reached by each tape (in cells).
+ */
+struct RunResult {
+  HaltReason reason;
+  std::uint64_t steps;
+  std::vector<std::uint64_t> tapeExtents;
+};
@@ -0,0 +1,96 @@
+/**
+ * @file segmentTape.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to represent a tape of a Turing Machine as a tree of hash-consed segments.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <unordered_map>
+
+#include "runLengthTape.hpp"
+#include "state.hpp"
+
+/**
+ * @brief Struct to represent a segment of two or more blocks: the ids of its left and right halves.
+ */
+struct SegmentNode {
+  std::uint32_t left;
+  std::uint32_t right;
+};
+
+/**
+ * @brief Struct to represent the effect of running a DTM over a segment, entering it by its first or its last cell: the
+ *        segment left, the state reached, whether the head left the segment by its left side (-1), its right side (1)
+ *        or stayed inside (0), the steps made, the position of the head if it stayed inside, the lowest and highest
+ *        positions visited (-1 and the size of the segment if it left it) and whether the DTM halted. The head stays
+ *        inside when the DTM halts or the step is cut short (see HashlifeEngine::MAX_SUBSTEPS).
+ */
+struct SegmentStep {
+  std::uint32_t node{0};
+  StateId state{0};
+  int exit{0};
+  std::uint64_t steps{0};
+  std::int64_t position{0};
+  std::int64_t lowest{0};
+  std::int64_t highest{0};
+  bool halted{false};
+};
+
+/**
+ * @brief Class to represent a tape as a perfect binary tree of segments. The leaves are blocks of blockSize cells
+ *        encoded as in MacroTape, and a segment of level k holds 2^k blocks.
+ *
+ *       - Segments are hash-consed: equal segments share a single node with a single id, so the memoized effects
+ *         of running over a segment (see HashlifeEngine) apply wherever it appears, and a tape of n equal blocks
+ *         takes O(log n) nodes. The id of a block is its macro symbol; the ids of larger segments follow.
+ *
+ *       - Nodes are never modified: writing a segment creates the nodes of the path from it to the root. They are
+ *         kept between runs, so later inputs reuse the segments (and their memoized effects) of former ones, until
+ *         Compact drops the ones the tape no longer holds. Only the segments the tape holds count as its memory.
+ *
+ *       - The root grows with blank segments when the head leaves it. The head is a cell from the first cell of
+ *         the root, and origin is the cell that held the first symbol of the input.
+ */
+class SegmentTape {
+  public:
+    SegmentTape(const unsigned, const unsigned);
+    SymbolCode Read() const;
+    std::uint64_t Head() const;
+    unsigned Height() const;
+    std::int64_t Cells(const unsigned) const;
+    unsigned BlockSize() const;
+    std::uint64_t NumberOfBlocks() const;
+    std::size_t NumberOfNodes() const;
+    SymbolCode Digit(const SymbolCode, const unsigned) const;
+    SymbolCode WithDigit(const SymbolCode, const unsigned, const SymbolCode) const;
+    SegmentNode Node(const std::uint32_t) const;
+    std::uint32_t Join(const std::uint32_t, const std::uint32_t);
+    void Path(std::vector<std::uint32_t>&) const;
+    void Replace(const std::vector<std::uint32_t>&, const unsigned, const std::uint32_t);
+    void MoveHead(const std::int64_t);
+    void Visit(const std::int64_t, const std::int64_t);
+    void InsertSymbols(const std::vector<SymbolCode>&);
+    void Compact();
+    std::uint64_t Extent() const;
+    std::uint64_t MemoryUsage() const;
+    const std::string ToString(const SymbolTable&) const;
+  private:
+    std::uint32_t Blank(const unsigned);
+    std::uint32_t Copy(const std::uint32_t, const unsigned, const std::vector<SegmentNode>&, std::unordered_map<std::uint32_t, std::uint32_t>&);
+    void Collect(const std::uint32_t, const unsigned, std::vector<SymbolRun>&) const;
+
+    unsigned blockSize;
+    unsigned radix;
+    std::vector<SymbolCode> powers;
+    std::vector<SegmentNode> nodes;
+    std::unordered_map<std::uint64_t, std::uint32_t> ids;
+    std::vector<std::uint32_t> blanks;
+    std::uint32_t root;
+    unsigned height;
+    std::uint64_t head;
+    std::int64_t origin;
+    std::int64_t leftmost;
+    std::int64_t rightmost;
+};
@@ -7,21 +7,24 @@
 
 #pragma once
 
-#include "transitionSet.hpp"
+#include <string>
+#include <vector>
 
 /**
- * @brief Class to represent a DTM state. A state is a node in the DTM graph that contains a set of transitions to other states.
+ * @brief Type to represent a state: its dense index in the StateArena of the DTM.
+ */
+using StateId = unsigned;
+
+/**
+ * @brief Class to represent a DTM state. A state is a node in the DTM graph; its transitions to other states are
+ *        stored in the TransitionTable of the DTM. States are stored in a StateArena, which identifies them by their
+ *        index and keeps their names.
  */
 class State {
   public:
-    State(const std::string&);
-    const std::string& ToString() const;
-    const TransitionSet& Transitions() const;
-    TransitionSet& Transitions();
+    State();
     void SetAsFinal();
     bool IsFinal() const;
   private:
-    const std::string name;
-    TransitionSet transitions;
     bool isFinal;
 };
@@ -0,0 +1,36 @@
+/**
+ * @file stateArena.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to store the states of a DTM contiguously.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <unordered_map>
+
+#include "state.hpp"
+
+/**
+ * @brief Class to store the states of a DTM in a single contiguous array, identified by dense ids from 0 to the number
+ *        of states minus one in the order they are added. Transitions refer to their next state by id, so following
+ *        them is an array access instead of a pointer dereference.
+ *
+ *       - The names of the states are kept in a side table, only used to look states up while reading a DTM and to
+ *         print them.
+ */
+class StateArena {
+  public:
+    StateId Add(const std::string&);
+    bool Contains(const std::string&) const;
+    StateId Id(const std::string&) const;
+    State& At(const StateId);
+    const State& At(const StateId) const;
+    const std::string& Name(const StateId) const;
+    unsigned Size() const;
+    std::string ToString() const;
+  private:
+    std::vector<State> states;
+    std::vector<std::string> names;
+    std::unordered_map<std::string, StateId> ids;
+};
@@ -0,0 +1,52 @@
+/**
+ * @file sweepDetector.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to detect DTM runs that sweep into blank tape forever.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include "dispatchTable.hpp"
+#include "executionContext.hpp"
+
+/**
+ * @brief Class to detect translated cycles of a DTM run made step by step: runs that repeat the same sequence of
+ *        states over the same local tape window shifted by a constant offset, with only blanks ahead of the heads.
+ *        Such runs never halt, but their tapes keep growing, so they never repeat a configuration exactly.
+ *
+ *       - A record is a step that takes a head to a cell further left or right than any visited before. Records are
+ *         numbered and, as in Brent's algorithm, a snapshot of the state and of WINDOW cells at each side of every
+ *         head is saved at every power of two.
+ *
+ *       - A later record of the same kind (same state, tape and direction) closes a translated cycle if, for every
+ *         tape, the cells visited since the snapshot, as they were in the snapshot, are now found shifted by the
+ *         distance its head moved, and every cell beyond them in the direction of that movement is blank. Then the
+ *         run repeats itself shifted from then on, so the verdict is exact.
+ */
+class SweepDetector {
+  public:
+    static const std::int64_t WINDOW;
+
+    SweepDetector();
+    void Reset(const ExecutionContext&);
+    bool Check(const ExecutionContext&);
+    bool Diverging() const;
+  private:
+    void Save(const ExecutionContext&, const unsigned, const Movement);
+    bool Matches(const ExecutionContext&) const;
+
+    std::vector<std::int64_t> leftmost;
+    std::vector<std::int64_t> rightmost;
+    std::uint64_t records;
+    std::uint64_t power;
+    bool diverging;
+    bool saved;
+    unsigned savedState;
+    unsigned savedTape;
+    Movement savedDirection;
+    std::vector<std::int64_t> savedPositions;
+    std::vector<std::int64_t> lowest;
+    std::vector<std::int64_t> highest;
+    std::vector<SymbolCode> savedCells;
+};
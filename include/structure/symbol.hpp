@@ -7,11 +7,14 @@
 
 #pragma once
 
+#include <set>
 #include <string>
 #include <vector>
 
 /**
- * @brief Class to represent a Symbol. A symbol is a character of the alphabet of a DTM. An input string is formed by a sequence of symbols.
+ * @brief Class to represent a Symbol. A symbol is a string of one or more characters of the alphabet of a DTM. An
+ *        input string is formed by a sequence of symbols. Tapes do not store symbols but their codes in the symbol
+ *        table of the DTM, so symbols are only handled while loading it.
  */
 class Symbol {
   public:
@@ -19,12 +22,16 @@ class Symbol {
 
     Symbol(const char);
     Symbol(const std::string&);
-    static std::vector<Symbol> ToSymbols(const std::string&);
     bool operator==(const Symbol&) const;
     bool operator!=(const Symbol&) const;
     bool operator<(const Symbol&) const;
-    Symbol& operator=(const Symbol&);
+    const std::string& Value() const;
     const std::string ToString() const;
   private: 
-    char value;
-};
\ No newline at end of file
+    std::string value;
+};
+
+/**
+ * @brief Type to represent an alphabet (a set of symbols) of a DTM.
+ */
+using Alphabet = std::set<Symbol>;
\ No newline at end of file
@@ -0,0 +1,41 @@
+/**
+ * @file symbolTable.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to intern the symbols of a tape alphabet into dense codes.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "symbol.hpp"
+
+/**
+ * @brief Type to represent an interned symbol: its code in the symbol table of the DTM.
+ */
+using SymbolCode = std::uint16_t;
+
+/**
+ * @brief Class to represent the interning of a tape alphabet: every symbol gets a dense code from 0 to |Γ| - 1, the
+ *        blank symbol being always 0, so a blank cell is a zero bit pattern and tapes can be grown with memset.
+ *
+ *       - The number of bits of a tape cell is the smallest of 1, 2, 8 or 16 that holds every code (see CellBits), so
+ *         alphabets of up to MAX_SYMBOLS symbols are supported. The last code is ANY, which transitions use to read any
+ *         symbol or to keep the symbol read.
+ */
+class SymbolTable {
+  public:
+    static const unsigned MAX_SYMBOLS;
+    static const SymbolCode ANY;
+
+    SymbolTable(const Alphabet&, const Symbol&);
+    SymbolCode Code(const Symbol&) const;
+    const Symbol& Decode(const SymbolCode) const;
+    unsigned Size() const;
+    unsigned CellBits() const;
+  private:
+    std::unordered_map<std::string, SymbolCode> codes;
+    std::vector<Symbol> symbols;
+};
@@ -7,24 +7,73 @@
 
 #pragma once
 
-#include "symbol.hpp"
+#include <algorithm>
+#include <cstdint>
+
+#include "symbolTable.hpp"
 #include "movement.hpp"
 
+/**
+ * @brief Struct to expose the cells of a tape of byte or 16-bit cells to machine code generated at run time, which
+ *        moves the head and updates the visited extents by itself. The size, the head and the extents count cells.
+ *        The code must hand the view back to the tape once the head reaches the first or the last cell, so the tape
+ *        grows.
+ */
+struct RawTape {
+  unsigned char* cells;
+  std::uint64_t size;
+  std::uint64_t head;
+  std::uint64_t leftmost;
+  std::uint64_t rightmost;
+};
+
 /**
  * @brief Class to represent a Tape of a Turing Machine. A tape is a sequence of symbols that can be read and written by 
  *        the Turing Machine.
+ *
+ *       - Cells hold the codes of the symbols (see SymbolTable) packed in bytes: 8 cells per byte for binary alphabets,
+ *         4 for alphabets of up to 4 symbols, 1 for alphabets of up to 256 symbols and 2 bytes per cell otherwise.
+ *         The blank symbol is a zero bit pattern, so the tape grows by whole zeroed bytes, as many as it already has
+ *         at either end.
  */
 class Tape {
   public:
-    Tape(const Symbol&);
-    void Write(const Symbol&);
-    const Symbol& Read() const;
+    static const unsigned MIN_GROWTH;
+
+    Tape(const unsigned);
+    void Write(const SymbolCode);
+    SymbolCode Read() const;
     void MoveHead(const Movement&);
+    std::uint64_t Scan(const std::vector<SymbolCode>&, const Movement&, const std::uint64_t);
+    std::uint64_t Match(const std::vector<SymbolCode>&, const Movement&, const std::uint64_t) const;
+    void Fill(const std::vector<SymbolCode>&, const Movement&, const std::uint64_t);
+    RawTape Expose();
+    void Absorb(const RawTape&);
     void Reset();
-    void InsertSymbols(const std::vector<Symbol>&);
-    const std::string ToString() const;
+    void InsertSymbols(const std::vector<SymbolCode>&);
+    unsigned CellBits() const;
+    std::uint64_t Extent() const;
+    std::uint64_t MemoryUsage() const;
+    std::int64_t Position() const;
+    std::int64_t Leftmost() const;
+    std::int64_t Rightmost() const;
+    SymbolCode At(const std::int64_t) const;
+    bool operator==(const Tape&) const;
+    const std::string ToString(const SymbolTable&) const;
   private:
-    std::vector<Symbol> symbols;
-    unsigned head;
-    Symbol blankSymbol;
+    SymbolCode Cell(const std::uint64_t) const;
+    void SetCell(const std::uint64_t, const SymbolCode);
+    std::uint64_t Size() const;
+    std::uint64_t CellsIn(const std::uint64_t) const;
+    std::uint64_t ScanCells(const std::vector<SymbolCode>&, const Movement&, const std::uint64_t) const;
+    void GrowLeft();
+    void GrowRight();
+
+    std::vector<std::uint8_t> cells;
+    std::uint64_t head;
+    std::uint64_t leftmost;
+    std::uint64_t rightmost;
+    std::uint64_t origin;
+    unsigned cellBits;
+    unsigned shift;
 };
\ No newline at end of file
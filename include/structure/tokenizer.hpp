@@ -0,0 +1,40 @@
+/**
+ * @file tokenizer.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to split input strings into the codes of their symbols.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string_view>
+
+#include "symbolTable.hpp"
+
+/**
+ * @brief Class to split an input string into symbols of the input alphabet and intern them. Without a separator,
+ *        every character is a symbol; with a separator, symbols are the (non empty) substrings between separators, so
+ *        they may have several characters. Epsilon symbols are skipped in both cases.
+ *
+ *       - Single-character symbols are looked up in a table indexed by the character, so splitting per character does
+ *         not compare strings.
+ *
+ *       - Symbols split by a separator are looked up by string_view, with keys viewing the values of the alphabet in
+ *         tokens. The strings are shared by the copies of the tokenizer, so the keys stay valid and splitting an
+ *         input does not build a string per symbol.
+ */
+class Tokenizer {
+  public:
+    Tokenizer(const Alphabet&, const SymbolTable&, const std::string&);
+    void Tokenize(const std::string_view, std::vector<SymbolCode>&) const;
+  private:
+    void Reject(const std::string_view) const;
+
+    std::array<int, 256> characterCodes;
+    std::shared_ptr<const std::vector<std::string>> tokens;
+    std::unordered_map<std::string_view, SymbolCode> tokenCodes;
+    std::string separator;
+    std::string alphabetString;
+};
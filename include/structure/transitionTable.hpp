@@ -0,0 +1,42 @@
+/**
+ * @file transitionTable.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to store the transitions of a DTM in a compressed sparse row layout.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include "state.hpp"
+#include "symbolTable.hpp"
+#include "movement.hpp"
+
+/**
+ * @brief Class to store every transition of a DTM in flat arrays, grouped by the state they belong to (compressed
+ *        sparse row layout): the transitions of a state are the indexes from Begin to End, and the codes read, the codes
+ *        written and the movements of a transition are NUMBER_OF_TAPES consecutive entries of their arrays.
+ *
+ *       - Transitions are appended in any order while reading a DTM and grouped by Compress, which keeps the order in
+ *         which the transitions of each state were added.
+ */
+class TransitionTable {
+  public:
+    TransitionTable(const unsigned);
+    void Add(const StateId, const std::vector<SymbolCode>&, const std::vector<SymbolCode>&, const std::vector<Movement>&, const StateId);
+    void Compress(const unsigned);
+    unsigned Begin(const StateId) const;
+    unsigned End(const StateId) const;
+    const SymbolCode* ReadSymbols(const unsigned) const;
+    const SymbolCode* WriteSymbols(const unsigned) const;
+    const Movement* Movements(const unsigned) const;
+    StateId NextState(const unsigned) const;
+    unsigned Size() const;
+  private:
+    unsigned numberOfTapes;
+    std::vector<unsigned> offsets;
+    std::vector<StateId> fromStates;
+    std::vector<SymbolCode> readSymbols;
+    std::vector<SymbolCode> writeSymbols;
+    std::vector<Movement> movements;
+    std::vector<StateId> nextStates;
+};
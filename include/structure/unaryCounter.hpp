@@ -0,0 +1,52 @@
+/**
+ * @file unaryCounter.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to represent a tape of a Turing Machine used as a unary counter.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <array>
+
+#include "runLengthTape.hpp"
+
+/**
+ * @brief Class to represent a tape that only ever holds a single block of cells with the same symbol (the marker),
+ *        the rest being blank, as a counter: the position of the first cell of the block and the number of cells
+ *        in it. Reads, writes and movements take constant time, and so do Scan, Match and Fill of a single symbol,
+ *        whatever the number of cells they cover, and the memory used does not depend on the count.
+ *
+ *       - Writing the marker next to the block or blank on one of its ends increments or decrements the counter. Any
+ *         other write must leave the block as it is: the tapes found by CounterEngine::FindCounters never split the
+ *         block nor write two different markers.
+ *
+ *       - Positions are relative to the first cell of the input, as in Tape::Position, and the visited extents are
+ *         kept as Tape does, so the counter prints as the tape it stands for.
+ */
+class UnaryCounter {
+  public:
+    UnaryCounter();
+    void Reset();
+    SymbolCode Read() const;
+    void Write(const SymbolCode);
+    void MoveHead(const Movement&);
+    std::uint64_t Scan(const std::vector<SymbolCode>&, const Movement&, const std::uint64_t);
+    std::uint64_t Match(const std::vector<SymbolCode>&, const Movement&, const std::uint64_t) const;
+    void Fill(const std::vector<SymbolCode>&, const Movement&, const std::uint64_t);
+    std::uint64_t Count() const;
+    std::uint64_t Extent() const;
+    std::uint64_t MemoryUsage() const;
+    std::int64_t Position() const;
+    const std::string ToString(const SymbolTable&) const;
+  private:
+    unsigned Runs(const Movement&, const std::uint64_t, std::array<SymbolRun, 3>&) const;
+    void Jump(const Movement&, const std::uint64_t);
+
+    SymbolCode marker;
+    std::int64_t first;
+    std::uint64_t count;
+    std::int64_t head;
+    std::int64_t leftmost;
+    std::int64_t rightmost;
+};
@@ -0,0 +1,94 @@
+/**
+ * @file boundedQueue.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class template to pass items between threads through a queue of bounded capacity.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+/**
+ * @brief Class template to represent a queue shared by producer and consumer threads. Producers block while the queue
+ *        is full, so a fast stage cannot run ahead of a slow one by more than the capacity. Once closed, pushes fail
+ *        and pops fail as soon as the queue is empty.
+ *
+ * @tparam T Type of the items.
+ */
+template <typename T>
+class BoundedQueue {
+  public:
+    BoundedQueue(const std::size_t);
+    bool Push(T&&);
+    bool Pop(T&);
+    void Close();
+  private:
+    std::mutex mutex;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    std::deque<T> items;
+    std::size_t capacity;
+    bool closed;
+};
+
+/**
+ * @brief Constructs a new BoundedQueue object.
+ *
+ * @param CAPACITY Maximum number of items in the queue.
+ */
+template <typename T>
+BoundedQueue<T>::BoundedQueue(const std::size_t CAPACITY) : capacity{CAPACITY}, closed{false} {}
+
+/**
+ * @brief Pushes an item, waiting while the queue is full.
+ *
+ * @param item Item to push.
+ * @return true If the item was pushed.
+ * @return false If the queue was closed.
+ */
+template <typename T>
+bool BoundedQueue<T>::Push(T&& item) {
+  std::unique_lock<std::mutex> lock{mutex};
+  notFull.wait(lock, [this]() { return closed || items.size() < capacity; });
+  if (closed) {
+    return false;
+  }
+  items.emplace_back(std::move(item));
+  notEmpty.notify_one();
+  return true;
+}
+
+/**
+ * @brief Pops the oldest item, waiting while the queue is empty and open.
+ *
+ * @param item Item popped.
+ * @return true If an item was popped.
+ * @return false If the queue is closed and empty.
+ */
+template <typename T>
+bool BoundedQueue<T>::Pop(T& item) {
+  std::unique_lock<std::mutex> lock{mutex};
+  notEmpty.wait(lock, [this]() { return closed || !items.empty(); });
+  if (items.empty()) {
+    return false;
+  }
+  item = std::move(items.front());
+  items.pop_front();
+  notFull.notify_one();
+  return true;
+}
+
+/**
+ * @brief Closes the queue, waking up every thread waiting on it. The items already pushed can still be popped.
+ */
+template <typename T>
+void BoundedQueue<T>::Close() {
+  const std::lock_guard<std::mutex> LOCK{mutex};
+  closed = true;
+  notFull.notify_all();
+  notEmpty.notify_all();
+}
@@ -0,0 +1,13 @@
+/**
+ * @file byteScan.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains vectorized functions to measure spans of bytes belonging to a set.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <cstddef>
+
+std::size_t SpanForward(const unsigned char*, const std::size_t, const unsigned char*, const std::size_t);
+std::size_t SpanBackward(const unsigned char*, const std::size_t, const unsigned char*, const std::size_t);
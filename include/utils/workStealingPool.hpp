@@ -0,0 +1,66 @@
+/**
+ * @file workStealingPool.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to run batches of independent tasks on a work-stealing thread pool.
+ * @date 17/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Type of the tasks run by the pool. They receive the index of the worker running them, so they can use
+ *        per-worker state without locking, and the index of the task.
+ */
+using PoolTask = std::function<void(const unsigned, const std::size_t)>;
+
+/**
+ * @brief Class to represent a pool of threads that run batches of independent tasks. The tasks of a batch are dealt
+ *        round-robin in a given order to one deque per worker. Each worker takes tasks from the front of its deque
+ *        and, once it is empty, steals from the back of the others, so workers that draw long tasks are relieved
+ *        by the rest.
+ *
+ *       - Dealing the tasks longest first keeps the long ones at the fronts, where they start early, and the short
+ *         ones at the backs, where they are stolen to fill the gaps.
+ */
+class WorkStealingPool {
+  public:
+    WorkStealingPool(const unsigned);
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+    unsigned Size() const;
+    void Run(const std::vector<std::size_t>&, const PoolTask&);
+    ~WorkStealingPool();
+  private:
+    /**
+     * @brief Struct to represent the deque of tasks of a worker.
+     */
+    struct Queue {
+      std::mutex mutex;
+      std::deque<std::size_t> tasks;
+    };
+
+    void Work(const unsigned);
+    bool Next(const unsigned, std::size_t&);
+
+    std::vector<std::thread> threads;
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::condition_variable done;
+    const PoolTask* task;
+    std::uint64_t batch;
+    unsigned busy;
+    bool stopping;
+    std::exception_ptr error;
+};
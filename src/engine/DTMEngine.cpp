@@ -0,0 +1,226 @@
+/**
+ * @file DTMEngine.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class template to run a DTM specialized on its number of tapes.
+ * @date 17/10/2026
+ */
+
+#include "../../include/engine/DTMEngine.hpp"
+
+/**
+ * @brief Runs the DTM from the configuration stored in the execution context.
+ * 
+ * @param TABLE Compiled transitions of the DTM.
+ * @param context Execution context of the run. Its state and steps are updated.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return true If the DTM made MAX_STEPS steps without halting.
+ * @return false If the DTM halted.
+ */
+template <unsigned K>
+bool DTMEngine<K>::Run(const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) {
+  if (K > 0 && TABLE.HasPackedActions()) {
+    return TABLE.ReadsAllTapes() ? RunPacked<false>(TABLE, context, MAX_STEPS) : RunPacked<true>(TABLE, context, MAX_STEPS);
+  }
+  std::array<Tape*, K> tapes;
+  for (unsigned i{0}; i < K; ++i) {
+    tapes[i] = &context.tapes[i];
+  }
+  unsigned state{context.state};
+  std::uint64_t steps{0};
+  bool halted{false};
+  while (steps < MAX_STEPS) {
+    std::uint64_t key;
+    if constexpr (K == 0) {
+      key = TABLE.Key(state, context.tapes);
+    } else {
+      key = Key<true>(TABLE, state, tapes, std::make_index_sequence<K>{});
+    }
+    const unsigned SLOT{TABLE.Lookup(state, key)};
+    if (SLOT == DispatchTable::HALT) {
+      halted = true;
+      break;
+    }
+    const CompiledTransition& TRANSITION{TABLE.Transition(SLOT)};
+    if (TRANSITION.scanTape != -1) {
+      const std::uint64_t SCANNED{context.tapes[TRANSITION.scanTape].Scan(TRANSITION.scanSymbols, TRANSITION.movements[TRANSITION.scanTape], MAX_STEPS - steps)};
+      if (SCANNED > 0) {
+        steps += SCANNED;
+        continue;
+      }
+    } else if (TRANSITION.loop != -1) {
+      const TransitionLoop& LOOP{TABLE.Loop(TRANSITION.loop)};
+      const std::uint64_t ITERATED{Iterate(LOOP, context.tapes, MAX_STEPS - steps)};
+      if (ITERATED > 0) {
+        steps += ITERATED;
+        state = LOOP.states[ITERATED % LOOP.states.size()];
+        continue;
+      }
+    }
+    if constexpr (K == 0) {
+      for (unsigned i{0}; i < context.tapes.size(); ++i) {
+        if (TRANSITION.writeSymbols[i] != SymbolTable::ANY) {
+          context.tapes[i].Write(TRANSITION.writeSymbols[i]);
+        }
+        context.tapes[i].MoveHead(TRANSITION.movements[i]);
+      }
+    } else {
+      Apply(TRANSITION, tapes, std::make_index_sequence<K>{});
+    }
+    state = TRANSITION.nextState;
+    ++steps;
+  }
+  context.state = state;
+  context.steps += steps;
+  return !halted;
+}
+
+/**
+ * @brief Runs the DTM like Run, reading the packed action of each transition instead of the compiled transition,
+ *        which is only read for scans and loops.
+ * 
+ * @param TABLE Compiled transitions of the DTM, with packed actions.
+ * @param context Execution context of the run. Its state and steps are updated.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return true If the DTM made MAX_STEPS steps without halting.
+ * @return false If the DTM halted.
+ */
+template <unsigned K>
+template <bool MASKED>
+bool DTMEngine<K>::RunPacked(const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) {
+  std::array<Tape*, K> tapes;
+  for (unsigned i{0}; i < K; ++i) {
+    tapes[i] = &context.tapes[i];
+  }
+  unsigned state{context.state};
+  std::uint64_t steps{0};
+  bool halted{false};
+  while (steps < MAX_STEPS) {
+    const std::uint64_t KEY{Key<MASKED>(TABLE, state, tapes, std::make_index_sequence<K>{})};
+    const unsigned SLOT{TABLE.Lookup(state, KEY)};
+    if (SLOT == DispatchTable::HALT) {
+      halted = true;
+      break;
+    }
+    const std::uint64_t ACTION{TABLE.Action(SLOT)};
+    if (DispatchTable::IsSummarized(ACTION)) {
+      const CompiledTransition& TRANSITION{TABLE.Transition(SLOT)};
+      if (TRANSITION.scanTape != -1) {
+        const std::uint64_t SCANNED{context.tapes[TRANSITION.scanTape].Scan(TRANSITION.scanSymbols, TRANSITION.movements[TRANSITION.scanTape], MAX_STEPS - steps)};
+        if (SCANNED > 0) {
+          steps += SCANNED;
+          continue;
+        }
+      } else if (TRANSITION.loop != -1) {
+        const TransitionLoop& LOOP{TABLE.Loop(TRANSITION.loop)};
+        const std::uint64_t ITERATED{Iterate(LOOP, context.tapes, MAX_STEPS - steps)};
+        if (ITERATED > 0) {
+          steps += ITERATED;
+          state = LOOP.states[ITERATED % LOOP.states.size()];
+          continue;
+        }
+      }
+    }
+    Apply(TABLE, ACTION, tapes, std::make_index_sequence<K>{});
+    state = TABLE.NextState(ACTION);
+    ++steps;
+  }
+  context.state = state;
+  context.steps += steps;
+  return !halted;
+}
+
+/**
+ * @brief Makes the steps of a loop from its first transition: as many as the moving tapes match the patterns it reads
+ *        (see Tape::Match), up to MAX_STEPS, with a single fill of every moving tape and a jump of its head. The tapes
+ *        that stay are not modified by the loop.
+ *
+ * @param LOOP Loop to run.
+ * @param tapes Tapes of the DTM.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return The number of steps made. The state reached is LOOP.states[steps % LOOP.states.size()].
+ */
+template <unsigned K>
+std::uint64_t DTMEngine<K>::Iterate(const TransitionLoop& LOOP, std::vector<Tape>& tapes, const std::uint64_t MAX_STEPS) {
+  std::uint64_t steps{MAX_STEPS};
+  for (unsigned i{0}; i < tapes.size() && steps > 0; ++i) {
+    if (LOOP.movements[i] != Movement::STAY) {
+      steps = tapes[i].Match(LOOP.readSymbols[i], LOOP.movements[i], steps);
+    }
+  }
+  for (unsigned i{0}; i < tapes.size() && steps > 0; ++i) {
+    tapes[i].Fill(LOOP.writeSymbols[i], LOOP.movements[i], steps);
+  }
+  return steps;
+}
+
+/**
+ * @brief Packs the symbols under the heads of the tapes into a key, one tape after another, skipping the tapes the
+ *        current state does not read (see DispatchTable::Key).
+ * 
+ * @tparam MASKED Whether some state does not read every tape. Otherwise the read masks are not loaded.
+ * @param TABLE Compiled transitions of the DTM.
+ * @param STATE Index of the current state.
+ * @param TAPES Tapes to read.
+ * @return The packed key of the read symbols.
+ */
+template <unsigned K>
+template <bool MASKED, std::size_t... I>
+std::uint64_t DTMEngine<K>::Key(const DispatchTable& TABLE, const unsigned STATE, const std::array<Tape*, K>& TAPES, std::index_sequence<I...>) {
+  std::uint64_t key{0};
+  if constexpr (MASKED) {
+    const std::uint64_t MASK{TABLE.ReadMask(STATE)};
+    ((key = TABLE.Extend(key, (MASK >> I & 1) ? TAPES[I]->Read() : 0)), ...);
+  } else {
+    ((key = TABLE.Extend(key, TAPES[I]->Read())), ...);
+  }
+  return key;
+}
+
+/**
+ * @brief Writes the symbols and moves the heads of a transition, one tape after another. Kept cells are not written.
+ * 
+ * @param TRANSITION Transition to apply.
+ * @param TAPES Tapes to modify.
+ */
+template <unsigned K>
+template <std::size_t... I>
+void DTMEngine<K>::Apply(const CompiledTransition& TRANSITION, const std::array<Tape*, K>& TAPES, std::index_sequence<I...>) {
+  (((TRANSITION.writeSymbols[I] != SymbolTable::ANY ? TAPES[I]->Write(TRANSITION.writeSymbols[I]) : void()), TAPES[I]->MoveHead(TRANSITION.movements[I])), ...);
+}
+
+/**
+ * @brief Writes the symbols and moves the heads of all the tapes as a packed action says. The generic engine (K = 0)
+ *        has no tapes to expand, so the table and the action may go unused.
+ * 
+ * @tparam I Indexes of the tapes.
+ * @param TABLE Dispatch table that decodes the action.
+ * @param ACTION Packed action to apply.
+ * @param TAPES Tapes of the DTM.
+ */
+template <unsigned K>
+template <std::size_t... I>
+void DTMEngine<K>::Apply([[maybe_unused]] const DispatchTable& TABLE, [[maybe_unused]] const std::uint64_t ACTION, const std::array<Tape*, K>& TAPES, std::index_sequence<I...>) {
+  (((TABLE.Writes(ACTION, I) ? TAPES[I]->Write(TABLE.WriteSymbol(ACTION, I)) : void()), TAPES[I]->MoveHead(TABLE.MovementOf(ACTION, I))), ...);
+}
+
+template class DTMEngine<0>;
+template class DTMEngine<1>;
+template class DTMEngine<2>;
+template class DTMEngine<3>;
+template class DTMEngine<4>;
+template class DTMEngine<5>;
+template class DTMEngine<6>;
+template class DTMEngine<7>;
+template class DTMEngine<8>;
+
+/**
+ * @brief Selects the engine specialized on a number of tapes, from 1 to 8. The generic engine is used for more tapes.
+ * 
+ * @param NUMBER_OF_TAPES Number of tapes of the DTM.
+ * @return The function to run the DTM.
+ */
+EngineRunner SelectEngine(const unsigned NUMBER_OF_TAPES) {
+  static const std::array<EngineRunner, 9> ENGINES{DTMEngine<0>::Run, DTMEngine<1>::Run, DTMEngine<2>::Run, DTMEngine<3>::Run, DTMEngine<4>::Run,
+                                                   DTMEngine<5>::Run, DTMEngine<6>::Run, DTMEngine<7>::Run, DTMEngine<8>::Run};
+  return NUMBER_OF_TAPES < ENGINES.size() ? ENGINES[NUMBER_OF_TAPES] : ENGINES[0];
+}
@@ -0,0 +1,229 @@
+/**
+ * @file counterEngine.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to run a DTM keeping the tapes it uses as unary counters as integers.
+ * @date 17/10/2026
+ */
+
+#include "../../include/engine/counterEngine.hpp"
+#include "../../include/structure/compiledMachine.hpp"
+
+/**
+ * @brief Place of the head of a counter whose block is empty, which can be any cell.
+ */
+const unsigned CounterEngine::EMPTY{1};
+
+/**
+ * @brief Place of the head of a counter on the last marker of its block.
+ */
+const unsigned CounterEngine::ON_LAST{2};
+
+/**
+ * @brief Place of the head of a counter on the blank cell right past the last marker of its block.
+ */
+const unsigned CounterEngine::PAST_LAST{4};
+
+/**
+ * @brief Finds the tapes a DTM uses as unary counters. The first tape, which holds the input, never is one.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param NUMBER_OF_TAPES Number of tapes of the DTM.
+ * @param INITIAL_STATE Index of the initial state of the DTM.
+ * @return A mask with a bit set for every tape used as a counter.
+ */
+std::uint64_t CounterEngine::FindCounters(const DispatchTable& TABLE, const unsigned NUMBER_OF_TAPES, const unsigned INITIAL_STATE) {
+  std::vector<std::vector<unsigned>> slotsOf(TABLE.NumberOfStates());
+  for (unsigned slot{0}; slot < TABLE.NumberOfTransitions(); ++slot) {
+    slotsOf[TABLE.Transition(slot).fromState].emplace_back(slot);
+  }
+  std::uint64_t counters{0};
+  for (unsigned i{1}; i < NUMBER_OF_TAPES && INITIAL_STATE < TABLE.NumberOfStates(); ++i) {
+    if (IsCounter(TABLE, slotsOf, INITIAL_STATE, i, Movement::RIGHT) || IsCounter(TABLE, slotsOf, INITIAL_STATE, i, Movement::LEFT)) {
+      counters |= std::uint64_t{1} << i;
+    }
+  }
+  return counters;
+}
+
+/**
+ * @brief Packs the symbols under the heads of the flat tapes and the counters a state reads into a key (see
+ *        DispatchTable::Key).
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param STATE Index of the current state.
+ * @param CONTEXT Execution context holding the tapes, with the counters in the tapes of its counter mask.
+ * @return The packed key of the read symbols.
+ */
+std::uint64_t CounterEngine::Key(const DispatchTable& TABLE, const unsigned STATE, const ExecutionContext& CONTEXT) {
+  const std::uint64_t MASK{TABLE.ReadMask(STATE)};
+  std::uint64_t key{0};
+  for (unsigned i{0}; i < CONTEXT.tapes.size(); ++i) {
+    key = TABLE.Extend(key, (MASK >> i & 1) == 0 ? 0 : (CONTEXT.counterMask >> i & 1) ? CONTEXT.counters[i].Read() : CONTEXT.tapes[i].Read());
+  }
+  return key;
+}
+
+/**
+ * @brief Runs the DTM from the configuration stored in the execution context, applying the transitions, scans and
+ *        loops to the counters in constant time.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param context Execution context of the run. Its state and steps are updated.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return true If the DTM did not halt.
+ * @return false If the DTM halted.
+ */
+bool CounterEngine::Run(const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) {
+  const std::uint64_t COUNTERS{context.counterMask};
+  std::vector<Tape>& tapes{context.tapes};
+  std::vector<UnaryCounter>& counters{context.counters};
+  unsigned state{context.state};
+  std::uint64_t steps{0};
+  std::uint64_t flatSteps{0};
+  for (std::uint64_t operations{0}; operations < CompiledMachine::CHECK_INTERVAL && flatSteps < CompiledMachine::CHECK_INTERVAL && steps < MAX_STEPS; ++operations) {
+    const std::uint64_t KEY{Key(TABLE, state, context)};
+    const unsigned SLOT{TABLE.Lookup(state, KEY)};
+    if (SLOT == DispatchTable::HALT) {
+      context.state = state;
+      context.steps += steps;
+      return false;
+    }
+    const CompiledTransition& TRANSITION{TABLE.Transition(SLOT)};
+    bool movesFlat{false};
+    for (unsigned i{0}; i < tapes.size(); ++i) {
+      movesFlat = movesFlat || ((COUNTERS >> i & 1) == 0 && TRANSITION.movements[i] != Movement::STAY);
+    }
+    const std::uint64_t LIMIT{movesFlat ? std::min(MAX_STEPS - steps, CompiledMachine::CHECK_INTERVAL - flatSteps) : MAX_STEPS - steps};
+    std::uint64_t summarized{0};
+    if (TRANSITION.scanTape != -1) {
+      const unsigned TAPE{static_cast<unsigned>(TRANSITION.scanTape)};
+      summarized = (COUNTERS >> TAPE & 1) ? counters[TAPE].Scan(TRANSITION.scanSymbols, TRANSITION.movements[TAPE], LIMIT)
+                                          : tapes[TAPE].Scan(TRANSITION.scanSymbols, TRANSITION.movements[TAPE], LIMIT);
+    } else if (TRANSITION.loop != -1) {
+      const TransitionLoop& LOOP{TABLE.Loop(TRANSITION.loop)};
+      summarized = Iterate(LOOP, context, LIMIT);
+      state = LOOP.states[summarized % LOOP.states.size()];
+    }
+    if (summarized > 0) {
+      steps += summarized;
+      flatSteps += movesFlat ? summarized : 0;
+      continue;
+    }
+    for (unsigned i{0}; i < tapes.size(); ++i) {
+      if (COUNTERS >> i & 1) {
+        if (TRANSITION.writeSymbols[i] != SymbolTable::ANY) {
+          counters[i].Write(TRANSITION.writeSymbols[i]);
+        }
+        counters[i].MoveHead(TRANSITION.movements[i]);
+      } else {
+        if (TRANSITION.writeSymbols[i] != SymbolTable::ANY) {
+          tapes[i].Write(TRANSITION.writeSymbols[i]);
+        }
+        tapes[i].MoveHead(TRANSITION.movements[i]);
+      }
+    }
+    state = TRANSITION.nextState;
+    ++steps;
+    flatSteps += movesFlat;
+  }
+  context.state = state;
+  context.steps += steps;
+  return true;
+}
+
+/**
+ * @brief Checks if a tape is used as a unary counter growing in a direction. The places the head can be in, relative
+ *        to the block of markers (EMPTY, ON_LAST and PAST_LAST), are propagated from the initial state, where the tape
+ *        is blank, through every transition that can read the symbol under the head in each place, until they do not
+ *        change. The marker is the first non-blank symbol written.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param SLOTS_OF Slots of the transitions of every state.
+ * @param INITIAL_STATE Index of the initial state of the DTM.
+ * @param TAPE Index of the tape.
+ * @param GROWTH Direction in which the block grows.
+ * @return true If every reachable transition keeps the tape a block of a single marker with the head in one of the
+ *         places.
+ * @return false Otherwise.
+ */
+bool CounterEngine::IsCounter(const DispatchTable& TABLE, const std::vector<std::vector<unsigned>>& SLOTS_OF, const unsigned INITIAL_STATE, const unsigned TAPE, const Movement& GROWTH) {
+  std::vector<unsigned> places(TABLE.NumberOfStates(), 0);
+  std::vector<unsigned> pending{INITIAL_STATE};
+  places[INITIAL_STATE] = EMPTY;
+  SymbolCode marker{SymbolTable::ANY};
+  while (!pending.empty()) {
+    const unsigned STATE{pending.back()};
+    pending.pop_back();
+    for (const unsigned SLOT : SLOTS_OF[STATE]) {
+      const CompiledTransition& TRANSITION{TABLE.Transition(SLOT)};
+      const int SHIFT{TRANSITION.movements[TAPE] == Movement::STAY ? 0 : TRANSITION.movements[TAPE] == GROWTH ? 1 : -1};
+      for (unsigned place{EMPTY}; place <= PAST_LAST; place <<= 1) {
+        const SymbolCode HELD{place == ON_LAST ? marker : SymbolCode{0}};
+        if ((places[STATE] & place) == 0 || (TRANSITION.readSymbols[TAPE] != SymbolTable::ANY && TRANSITION.readSymbols[TAPE] != HELD)) {
+          continue;
+        }
+        const SymbolCode WRITTEN{TRANSITION.writeSymbols[TAPE] == SymbolTable::ANY ? HELD : TRANSITION.writeSymbols[TAPE]};
+        if (WRITTEN != 0 && marker == SymbolTable::ANY) {
+          marker = WRITTEN;
+        }
+        const unsigned NEXT{WRITTEN == 0 || WRITTEN == marker ? NextPlaces(place, WRITTEN != 0, SHIFT) : 0};
+        if (NEXT == 0) {
+          return false;
+        }
+        if ((places[TRANSITION.nextState] & NEXT) != NEXT) {
+          places[TRANSITION.nextState] |= NEXT;
+          pending.emplace_back(TRANSITION.nextState);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the places the head of a counter can be in after a transition.
+ *
+ * @param PLACE Place of the head before the transition.
+ * @param MARKS Whether the transition writes the marker (or keeps it) rather than blank.
+ * @param SHIFT Movement of the head: 1 in the direction the block grows, -1 in the other one or 0.
+ * @return The places after the transition, or 0 if the transition may split the block or leave the head elsewhere.
+ */
+unsigned CounterEngine::NextPlaces(const unsigned PLACE, const bool MARKS, const int SHIFT) {
+  if (MARKS) {
+    return SHIFT == 1 ? PAST_LAST : SHIFT == 0 ? ON_LAST : 0;
+  }
+  if (PLACE == EMPTY) {
+    return EMPTY;
+  }
+  if (PLACE == PAST_LAST) {
+    return SHIFT == 1 ? 0 : SHIFT == 0 ? PAST_LAST : ON_LAST;
+  }
+  return SHIFT == 1 ? 0 : SHIFT == 0 ? PAST_LAST | EMPTY : ON_LAST | EMPTY;
+}
+
+/**
+ * @brief Makes the steps of a loop from its first transition, as DTMEngine does, matching and filling the counters
+ *        in constant time.
+ *
+ * @param LOOP Loop to run.
+ * @param context Execution context holding the tapes and the counters.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return The number of steps made.
+ */
+std::uint64_t CounterEngine::Iterate(const TransitionLoop& LOOP, ExecutionContext& context, const std::uint64_t MAX_STEPS) {
+  const std::uint64_t COUNTERS{context.counterMask};
+  std::uint64_t steps{MAX_STEPS};
+  for (unsigned i{0}; i < context.tapes.size() && steps > 0; ++i) {
+    if (LOOP.movements[i] != Movement::STAY) {
+      steps = (COUNTERS >> i & 1) ? context.counters[i].Match(LOOP.readSymbols[i], LOOP.movements[i], steps) : context.tapes[i].Match(LOOP.readSymbols[i], LOOP.movements[i], steps);
+    }
+  }
+  for (unsigned i{0}; i < context.tapes.size() && steps > 0; ++i) {
+    if (COUNTERS >> i & 1) {
+      context.counters[i].Fill(LOOP.writeSymbols[i], LOOP.movements[i], steps);
+    } else {
+      context.tapes[i].Fill(LOOP.writeSymbols[i], LOOP.movements[i], steps);
+    }
+  }
+  return steps;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file hashlifeEngine.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to run a single-tape DTM over memoized segments of its tape.
+ * @date 17/10/2026
+ */
+
+#include <limits>
+
+#include "../../include/engine/hashlifeEngine.hpp"
+#include "../../include/structure/compiledMachine.hpp"
+
+/**
+ * @brief Maximum number of sub-steps of a memoized segment step.
+ */
+const std::uint64_t HashlifeEngine::MAX_SUBSTEPS{1u << 8};
+
+/**
+ * @brief Number of segments, or memoized segment steps, above which the segments the tape does not hold are dropped.
+ */
+const std::size_t HashlifeEngine::MAX_NODES{1u << 20};
+
+/**
+ * @brief Runs the DTM on the segment tape of the execution context, one segment step at a time. At most
+ *        CompiledMachine::CHECK_INTERVAL segment steps are made per call, whatever the steps they add up to.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param context Execution context of the run. Its state, steps and memoized segment steps are updated.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return true If the DTM did not halt.
+ * @return false If the DTM halted.
+ */
+bool HashlifeEngine::Run(const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) {
+  SegmentTape& tape{context.segmentTapes[0]};
+  const unsigned BLOCK_SIZE{tape.BlockSize()};
+  std::vector<std::uint32_t> path;
+  unsigned state{context.state};
+  std::uint64_t steps{0};
+  bool halted{false};
+  for (std::uint64_t operations{0}; operations < CompiledMachine::CHECK_INTERVAL && steps < MAX_STEPS && !halted; ++operations) {
+    if (tape.NumberOfNodes() > MAX_NODES || context.segmentSteps.size() > MAX_NODES) {
+      tape.Compact();
+      context.segmentSteps.clear();
+    }
+    const std::uint64_t REMAINING{MAX_STEPS - steps};
+    const std::uint64_t BLOCK{tape.Head() / BLOCK_SIZE};
+    const unsigned OFFSET{static_cast<unsigned>(tape.Head() % BLOCK_SIZE)};
+    tape.Path(path);
+    unsigned level{0};
+    SegmentStep step;
+    bool found{false};
+    if (OFFSET == 0 || OFFSET == BLOCK_SIZE - 1) {
+      unsigned leftLevels{0}, rightLevels{0};
+      while (leftLevels < tape.Height() && (BLOCK >> leftLevels & 1) == 0) {
+        ++leftLevels;
+      }
+      while (rightLevels < tape.Height() && (BLOCK >> rightLevels & 1) == 1) {
+        ++rightLevels;
+      }
+      const int SIDE{BLOCK_SIZE == 1 ? leftLevels < rightLevels : OFFSET != 0};
+      for (level = SIDE ? rightLevels : leftLevels; ; --level) {
+        step = Step(TABLE, tape, context.segmentSteps, state, path[level], level, SIDE);
+        found = Fits(step, REMAINING);
+        if (found || level == 0) {
+          break;
+        }
+      }
+    }
+    if (!found) {
+      step = Simulate(TABLE, tape, path[0], state, OFFSET, std::min(REMAINING, MAX_SUBSTEPS));
+    }
+    const std::int64_t START{static_cast<std::int64_t>(BLOCK >> level << level) * BLOCK_SIZE};
+    tape.Replace(path, level, step.node);
+    tape.Visit(START + step.lowest, START + step.highest);
+    tape.MoveHead(step.exit < 0 ? START - 1 : step.exit > 0 ? START + tape.Cells(level) : START + step.position);
+    steps += step.steps;
+    state = step.state;
+    halted = step.halted;
+  }
+  context.state = state;
+  context.steps += steps;
+  return !halted;
+}
+
+/**
+ * @brief Returns the memoized step of a segment, computing it if it has not been computed yet: the step of a block
+ *        is simulated and the step of a larger segment composed from the steps of its halves.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param tape Segment tape that holds the segment. The segments made by the step are added to it.
+ * @param memo Segment steps computed so far.
+ * @param STATE Index of the state the step starts from.
+ * @param ID Id of the segment.
+ * @param LEVEL Level of the segment.
+ * @param SIDE Side the head enters the segment by: 0 for its first cell, 1 for its last cell.
+ * @return The segment step.
+ */
+const SegmentStep& HashlifeEngine::Step(const DispatchTable& TABLE, SegmentTape& tape, std::unordered_map<std::uint64_t, SegmentStep>& memo, const StateId STATE, const std::uint32_t ID, const unsigned LEVEL, const int SIDE) {
+  const std::uint64_t KEY{(static_cast<std::uint64_t>(ID) * TABLE.NumberOfStates() + STATE) * 2 + SIDE};
+  const auto FOUND{memo.find(KEY)};
+  if (FOUND != memo.end()) {
+    return FOUND->second;
+  }
+  if (LEVEL == 0) {
+    return memo.emplace(KEY, Simulate(TABLE, tape, ID, STATE, SIDE ? tape.BlockSize() - 1 : 0, MAX_SUBSTEPS)).first->second;
+  }
+  const SegmentNode NODE{tape.Node(ID)};
+  const std::int64_t HALF{tape.Cells(LEVEL - 1)};
+  std::uint32_t halves[2]{NODE.left, NODE.right};
+  int half{SIDE};
+  SegmentStep step{ID, STATE, 0, 0, SIDE * (2 * HALF - 1), SIDE * (2 * HALF - 1), SIDE * (2 * HALF - 1), false};
+  for (std::uint64_t substeps{0}; substeps < MAX_SUBSTEPS; ++substeps) {
+    const SegmentStep HALF_STEP{Step(TABLE, tape, memo, step.state, halves[half], LEVEL - 1, half == 0 ? step.position != 0 : step.position != HALF)};
+    if (HALF_STEP.steps > std::numeric_limits<std::uint64_t>::max() - step.steps) {
+      break;
+    }
+    halves[half] = HALF_STEP.node;
+    step.state = HALF_STEP.state;
+    step.steps += HALF_STEP.steps;
+    step.lowest = std::min(step.lowest, half * HALF + HALF_STEP.lowest);
+    step.highest = std::max(step.highest, half * HALF + HALF_STEP.highest);
+    if (HALF_STEP.exit == 0) {
+      step.position = half * HALF + HALF_STEP.position;
+      step.halted = HALF_STEP.halted;
+      break;
+    }
+    if (HALF_STEP.exit != (half == 0 ? 1 : -1)) {
+      step.exit = HALF_STEP.exit;
+      break;
+    }
+    half = 1 - half;
+    step.position = half == 0 ? HALF - 1 : HALF;
+  }
+  step.node = tape.Join(halves[0], halves[1]);
+  return memo.emplace(KEY, step).first->second;
+}
+
+/**
+ * @brief Checks if a segment step can be applied with some steps left: it makes some steps, but not too many, or the
+ *        DTM halts.
+ *
+ * @param STEP Segment step to check.
+ * @param REMAINING Steps left.
+ * @return true If the step can be applied.
+ * @return false Otherwise.
+ */
+bool HashlifeEngine::Fits(const SegmentStep& STEP, const std::uint64_t REMAINING) {
+  return STEP.steps <= REMAINING && (STEP.steps > 0 || STEP.halted);
+}
+
+/**
+ * @brief Runs the DTM cell by cell inside a block until the head leaves the block, the DTM halts or MAX_STEPS steps
+ *        are made.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param TAPE Segment tape that decodes the block.
+ * @param BLOCK Macro symbol of the block.
+ * @param STATE Index of the state the simulation starts from.
+ * @param OFFSET Offset of the head inside the block.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return The segment step made over the block.
+ */
+SegmentStep HashlifeEngine::Simulate(const DispatchTable& TABLE, const SegmentTape& TAPE, const SymbolCode BLOCK, const StateId STATE, const unsigned OFFSET, const std::uint64_t MAX_STEPS) {
+  const std::int64_t BLOCK_SIZE{TAPE.BlockSize()};
+  SymbolCode block{BLOCK};
+  std::int64_t offset{OFFSET};
+  SegmentStep step{BLOCK, STATE, 0, 0, offset, offset, offset, false};
+  while (step.steps < MAX_STEPS) {
+    const SymbolCode READ{(TABLE.ReadMask(step.state) & 1) ? TAPE.Digit(block, offset) : SymbolCode{0}};
+    const unsigned SLOT{TABLE.Lookup(step.state, TABLE.Extend(0, READ))};
+    if (SLOT == DispatchTable::HALT) {
+      step.halted = true;
+      break;
+    }
+    const CompiledTransition& TRANSITION{TABLE.Transition(SLOT)};
+    if (TRANSITION.writeSymbols[0] != SymbolTable::ANY) {
+      block = TAPE.WithDigit(block, offset, TRANSITION.writeSymbols[0]);
+    }
+    offset += TRANSITION.movements[0] == Movement::LEFT ? -1 : TRANSITION.movements[0] == Movement::RIGHT ? 1 : 0;
+    step.lowest = std::min(step.lowest, offset);
+    step.highest = std::max(step.highest, offset);
+    step.state = TRANSITION.nextState;
+    ++step.steps;
+    if (offset < 0 || offset >= BLOCK_SIZE) {
+      step.exit = offset < 0 ? -1 : 1;
+      break;
+    }
+  }
+  step.node = block;
+  step.position = offset;
+  return step;
+}
@@ -0,0 +1,332 @@
+/**
+ * @file jitEngine.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to run a DTM compiled in process to x86-64 machine code.
+ * @date 17/10/2026
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+
+#include "../../include/engine/jitEngine.hpp"
+#include "../../include/engine/x64Assembler.hpp"
+
+#if defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__))
+#define JIT_ENGINE_X86_64
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Registers that hold the head pointers of the tapes. The caller-saved ones are spilled around calls to grow.
+ */
+static const std::array<Register, JitEngine::MAX_TAPES> HEADS{Register::R12, Register::R13, Register::R14, Register::R15,
+                                                              Register::R8, Register::R9, Register::R10, Register::R11};
+
+/**
+ * @brief Registers saved by the generated code, as required by the System V ABI.
+ */
+static const std::array<Register, 6> SAVED{Register::RBX, Register::RBP, Register::R12, Register::R13, Register::R14, Register::R15};
+
+/**
+ * @brief Returns the displacement from a JitRun of a field of one of its tapes.
+ */
+static std::int32_t TapeField(const unsigned TAPE, const std::size_t FIELD) {
+  return static_cast<std::int32_t>(offsetof(JitRun, tapes) + TAPE * sizeof(JitTape) + FIELD);
+}
+
+/**
+ * @brief Returns the view of a tape handed to the generated code.
+ */
+static JitTape ToJit(const RawTape& RAW) {
+  return JitTape{RAW.cells + RAW.head, RAW.cells + RAW.leftmost, RAW.cells + RAW.rightmost, RAW.cells, RAW.cells + RAW.size - 1};
+}
+
+/**
+ * @brief Returns the view of a tape modified by the generated code as indexes, to hand it back to the tape.
+ */
+static RawTape ToRaw(const JitTape& TAPE) {
+  return RawTape{TAPE.first, static_cast<std::uint64_t>(TAPE.last - TAPE.first) + 1, static_cast<std::uint64_t>(TAPE.head - TAPE.first),
+                 static_cast<std::uint64_t>(TAPE.leftmost - TAPE.first), static_cast<std::uint64_t>(TAPE.rightmost - TAPE.first)};
+}
+
+/**
+ * @brief Class to generate the machine code of a DTM. Register rbx holds the JitRun, rbp the remaining steps and
+ *        HEADS the head pointers.
+ */
+class JitCompiler {
+  public:
+    JitCompiler(const DispatchTable& TABLE, const unsigned NUMBER_OF_TAPES) : table{TABLE}, numberOfTapes{NUMBER_OF_TAPES} {}
+
+    /**
+     * @brief Generates the code of the function that runs the DTM (see JitRun).
+     *
+     * @return The machine code.
+     */
+    std::vector<unsigned char> Compile() {
+      std::vector<std::vector<unsigned>> slotsByState(table.NumberOfStates());
+      for (unsigned slot{0}; slot < table.NumberOfTransitions(); ++slot) {
+        if (!table.Transition(slot).expanded) {
+          slotsByState[table.Transition(slot).fromState].emplace_back(slot);
+        }
+      }
+      for (unsigned state{0}; state < table.NumberOfStates(); ++state) {
+        states.emplace_back(assembler.NewLabel());
+      }
+      halt = assembler.NewLabel();
+      budget = assembler.NewLabel();
+      const unsigned EXIT{assembler.NewLabel()};
+      for (const auto& REGISTER : SAVED) {
+        assembler.Push(REGISTER);
+      }
+      assembler.Add(Register::RSP, -8);
+      assembler.Move(Register::RBX, Register::RDI);
+      assembler.Load(Register::RBP, Register::RBX, offsetof(JitRun, maxSteps));
+      LoadHeads();
+      assembler.Load32(Register::RAX, Register::RBX, offsetof(JitRun, state));
+      for (unsigned state{0}; state < table.NumberOfStates(); ++state) {
+        assembler.Compare(Register::RAX, state);
+        assembler.Jump(Condition::EQUAL, states[state]);
+      }
+      assembler.Jump(Condition::ALWAYS, halt);
+      for (unsigned state{0}; state < table.NumberOfStates(); ++state) {
+        assembler.Bind(states[state]);
+        const unsigned MISS{assembler.NewLabel()};
+        if (!slotsByState[state].empty()) {
+          EmitDispatch(slotsByState[state], 0, MISS);
+        }
+        assembler.Bind(MISS);
+        EmitWildcardRows(state);
+        assembler.Store32(Register::RBX, offsetof(JitRun, state), state);
+        assembler.Jump(Condition::ALWAYS, halt);
+      }
+      assembler.Bind(halt);
+      assembler.Move(Register::RAX, std::uint32_t{1});
+      assembler.Jump(Condition::ALWAYS, EXIT);
+      assembler.Bind(budget);
+      assembler.Move(Register::RAX, std::uint32_t{0});
+      assembler.Bind(EXIT);
+      StoreHeads();
+      assembler.Load(Register::RCX, Register::RBX, offsetof(JitRun, maxSteps));
+      assembler.Subtract(Register::RCX, Register::RBP);
+      assembler.Store(Register::RBX, offsetof(JitRun, steps), Register::RCX);
+      assembler.Add(Register::RSP, 8);
+      for (auto it{SAVED.rbegin()}; it != SAVED.rend(); ++it) {
+        assembler.Pop(*it);
+      }
+      assembler.Return();
+      return assembler.Code();
+    }
+  private:
+    /**
+     * @brief Emits the compare/branch tree over the symbol read from a tape that selects among transitions of a state
+     *        sharing the symbols read from the previous tapes. Symbols without a transition jump to MISS, where the
+     *        wildcard rows of the state are tested. Tapes the state does not read are not compared.
+     */
+    void EmitDispatch(const std::vector<unsigned>& SLOTS, const unsigned TAPE, const unsigned MISS) {
+      if (TAPE == numberOfTapes) {
+        EmitTransition(table.Transition(SLOTS.front()));
+        return;
+      }
+      if (table.Transition(SLOTS.front()).readSymbols[TAPE] == SymbolTable::ANY) {
+        EmitDispatch(SLOTS, TAPE + 1, MISS);
+        return;
+      }
+      std::map<unsigned, std::vector<unsigned>> bySymbol;
+      for (const auto& SLOT : SLOTS) {
+        bySymbol[table.Transition(SLOT).readSymbols[TAPE]].emplace_back(SLOT);
+      }
+      assembler.LoadByte(Register::RAX, HEADS[TAPE], 0);
+      std::vector<unsigned> cases;
+      for (const auto& [SYMBOL, SYMBOL_SLOTS] : bySymbol) {
+        cases.emplace_back(assembler.NewLabel());
+        assembler.CompareAl(static_cast<std::uint8_t>(SYMBOL));
+        assembler.Jump(Condition::EQUAL, cases.back());
+      }
+      assembler.Jump(Condition::ALWAYS, MISS);
+      unsigned i{0};
+      for (const auto& [SYMBOL, SYMBOL_SLOTS] : bySymbol) {
+        assembler.Bind(cases[i++]);
+        EmitDispatch(SYMBOL_SLOTS, TAPE + 1, MISS);
+      }
+    }
+
+    /**
+     * @brief Emits the wildcard rows of a state, tested one after another in the order they take precedence, so a
+     *        row costs one comparison per symbol it reads instead of one branch per combination of the symbols it does
+     *        not.
+     */
+    void EmitWildcardRows(const unsigned STATE) {
+      for (unsigned row{table.WildcardRowsBegin(STATE)}; row < table.WildcardRowsEnd(STATE); ++row) {
+        const CompiledTransition& ROW{table.WildcardRow(row)};
+        const unsigned NEXT{assembler.NewLabel()};
+        for (unsigned i{0}; i < numberOfTapes; ++i) {
+          if (ROW.readSymbols[i] != SymbolTable::ANY) {
+            assembler.LoadByte(Register::RAX, HEADS[i], 0);
+            assembler.CompareAl(static_cast<std::uint8_t>(ROW.readSymbols[i]));
+            assembler.Jump(Condition::NOT_EQUAL, NEXT);
+          }
+        }
+        EmitTransition(ROW);
+        assembler.Bind(NEXT);
+      }
+    }
+
+    /**
+     * @brief Emits the straight-line code of a transition: writes, movements (growing the tapes when needed), step
+     *        count and jump to the next state. Cells written with SymbolTable::ANY are kept.
+     */
+    void EmitTransition(const CompiledTransition& TRANSITION) {
+      for (unsigned i{0}; i < numberOfTapes; ++i) {
+        if (TRANSITION.writeSymbols[i] != SymbolTable::ANY && TRANSITION.writeSymbols[i] != TRANSITION.readSymbols[i]) {
+          assembler.StoreByte(HEADS[i], 0, static_cast<std::uint8_t>(TRANSITION.writeSymbols[i]));
+        }
+        if (TRANSITION.movements[i] == Movement::STAY) {
+          continue;
+        }
+        const bool LEFT{TRANSITION.movements[i] == Movement::LEFT};
+        const unsigned DONE{assembler.NewLabel()};
+        const std::int32_t EXTENT{TapeField(i, LEFT ? offsetof(JitTape, leftmost) : offsetof(JitTape, rightmost))};
+        if (LEFT) {
+          assembler.Decrement(HEADS[i]);
+        } else {
+          assembler.Increment(HEADS[i]);
+        }
+        assembler.Compare(HEADS[i], Register::RBX, EXTENT);
+        assembler.Jump(LEFT ? Condition::ABOVE_EQUAL : Condition::BELOW_EQUAL, DONE);
+        assembler.Store(Register::RBX, EXTENT, HEADS[i]);
+        assembler.Compare(HEADS[i], Register::RBX, TapeField(i, LEFT ? offsetof(JitTape, first) : offsetof(JitTape, last)));
+        assembler.Jump(Condition::NOT_EQUAL, DONE);
+        StoreHeads();
+        assembler.Move(Register::RDI, Register::RBX);
+        assembler.Move(Register::RSI, i);
+        assembler.Call(Register::RBX, offsetof(JitRun, grow));
+        LoadHeads();
+        assembler.Bind(DONE);
+      }
+      assembler.Decrement(Register::RBP);
+      assembler.Jump(Condition::NOT_EQUAL, states[TRANSITION.nextState]);
+      assembler.Store32(Register::RBX, offsetof(JitRun, state), TRANSITION.nextState);
+      assembler.Jump(Condition::ALWAYS, budget);
+    }
+
+    /**
+     * @brief Emits the loads of the head pointers from the JitRun.
+     */
+    void LoadHeads() {
+      for (unsigned i{0}; i < numberOfTapes; ++i) {
+        assembler.Load(HEADS[i], Register::RBX, TapeField(i, offsetof(JitTape, head)));
+      }
+    }
+
+    /**
+     * @brief Emits the stores of the head pointers into the JitRun.
+     */
+    void StoreHeads() {
+      for (unsigned i{0}; i < numberOfTapes; ++i) {
+        assembler.Store(Register::RBX, TapeField(i, offsetof(JitTape, head)), HEADS[i]);
+      }
+    }
+
+    const DispatchTable& table;
+    const unsigned numberOfTapes;
+    X64Assembler assembler;
+    std::vector<unsigned> states;
+    unsigned halt;
+    unsigned budget;
+};
+
+/**
+ * @brief Checks if DTMs with a given number of tapes and symbols can be compiled on this platform.
+ *
+ * @param NUMBER_OF_TAPES Number of tapes of the DTM.
+ * @param NUMBER_OF_SYMBOLS Number of symbols of the tape alphabet of the DTM.
+ * @return true If the platform is x86-64 Unix, the DTM has between 1 and MAX_TAPES tapes and its symbols fit in a byte.
+ * @return false Otherwise.
+ */
+bool JitEngine::IsSupported(const unsigned NUMBER_OF_TAPES, const unsigned NUMBER_OF_SYMBOLS) {
+#ifdef JIT_ENGINE_X86_64
+  return NUMBER_OF_TAPES > 0 && NUMBER_OF_TAPES <= MAX_TAPES && NUMBER_OF_SYMBOLS <= 256;
+#else
+  return false;
+#endif
+}
+
+/**
+ * @brief Compiles a DTM to machine code and maps it into an executable region.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param NUMBER_OF_TAPES Number of tapes of the DTM.
+ * @param NUMBER_OF_SYMBOLS Number of symbols of the tape alphabet of the DTM.
+ * @throw std::runtime_error If the DTM is not supported (see IsSupported) or the code cannot be mapped.
+ */
+JitEngine::JitEngine(const DispatchTable& TABLE, const unsigned NUMBER_OF_TAPES, const unsigned NUMBER_OF_SYMBOLS) : code{nullptr}, size{0}, function{nullptr} {
+  if (!IsSupported(NUMBER_OF_TAPES, NUMBER_OF_SYMBOLS)) {
+    throw std::runtime_error{"Runtime error: The JIT engine does not support this DTM on this platform"};
+  }
+#ifdef JIT_ENGINE_X86_64
+  const std::vector<unsigned char> MACHINE_CODE{JitCompiler{TABLE, NUMBER_OF_TAPES}.Compile()};
+  const std::uint64_t PAGE_SIZE{static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE))};
+  size = (MACHINE_CODE.size() + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+  code = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (code == MAP_FAILED) {
+    code = nullptr;
+    throw std::runtime_error{"Runtime error: Could not map memory for the JIT engine"};
+  }
+  std::memcpy(code, MACHINE_CODE.data(), MACHINE_CODE.size());
+  if (mprotect(code, size, PROT_READ | PROT_EXEC) != 0) {
+    munmap(code, size);
+    throw std::runtime_error{"Runtime error: Could not make the code of the JIT engine executable"};
+  }
+  function = reinterpret_cast<int (*)(JitRun*)>(code);
+#endif
+}
+
+/**
+ * @brief Runs the machine code from the configuration stored in the execution context.
+ *
+ * @param TABLE Compiled transitions of the DTM the code was generated from, unused as the code already holds them.
+ * @param context Execution context of the run. Its state and steps are updated.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return true If the DTM made MAX_STEPS steps without halting.
+ * @return false If the DTM halted.
+ */
+bool JitEngine::Run([[maybe_unused]] const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) const {
+  if (MAX_STEPS == 0) {
+    return true;
+  }
+  JitRun run{{}, &Grow, &context, MAX_STEPS, 0, context.state};
+  for (unsigned i{0}; i < context.tapes.size(); ++i) {
+    run.tapes[i] = ToJit(context.tapes[i].Expose());
+  }
+  const bool HALTED{function(&run) == 1};
+  for (unsigned i{0}; i < context.tapes.size(); ++i) {
+    context.tapes[i].Absorb(ToRaw(run.tapes[i]));
+  }
+  context.state = run.state;
+  context.steps += run.steps;
+  return !HALTED;
+}
+
+/**
+ * @brief Unmaps the machine code.
+ */
+JitEngine::~JitEngine() {
+#ifdef JIT_ENGINE_X86_64
+  munmap(code, size);
+#endif
+}
+
+/**
+ * @brief Grows a tape whose head reached its first or last cell while running machine code and refreshes its view.
+ *
+ * @param run Arguments of the machine code.
+ * @param TAPE Index of the tape.
+ */
+void JitEngine::Grow(JitRun* run, const unsigned TAPE) {
+  Tape& tape{static_cast<ExecutionContext*>(run->host)->tapes[TAPE]};
+  tape.Absorb(ToRaw(run->tapes[TAPE]));
+  run->tapes[TAPE] = ToJit(tape.Expose());
+}
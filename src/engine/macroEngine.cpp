@@ -0,0 +1,161 @@
+/**
+ * @file macroEngine.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to run a single-tape DTM as a macro machine over blocks of cells.
+ * @date 17/10/2026
+ */
+
+#include "../../include/engine/macroEngine.hpp"
+#include "../../include/structure/compiledMachine.hpp"
+
+/**
+ * @brief Maximum number of distinct blocks of the default block size.
+ */
+const unsigned MacroEngine::MAX_DEFAULT_BLOCKS{1u << 8};
+
+/**
+ * @brief Maximum number of slots of the table of memoized macro steps.
+ */
+const std::uint64_t MacroEngine::MAX_DENSE_STEPS{1u << 16};
+
+/**
+ * @brief Returns the default block size for a tape alphabet: the largest one (up to 8 cells) with at most
+ *        MAX_DEFAULT_BLOCKS distinct blocks, and at least one cell.
+ *
+ * @param RADIX Number of symbols of the tape alphabet.
+ * @return The default number of cells of a block.
+ */
+unsigned MacroEngine::DefaultBlockSize(const unsigned RADIX) {
+  unsigned blockSize{1};
+  std::uint64_t blocks{RADIX};
+  while (blockSize < 8 && blocks * RADIX <= MAX_DEFAULT_BLOCKS) {
+    blocks *= RADIX;
+    ++blockSize;
+  }
+  return blockSize;
+}
+
+/**
+ * @brief Checks if every block of a size fits in a symbol code (see MacroTape).
+ *
+ * @param BLOCK_SIZE Number of cells of a block.
+ * @param RADIX Number of symbols of the tape alphabet.
+ * @return true If there are at most SymbolTable::MAX_SYMBOLS distinct blocks of at most 16 cells.
+ * @return false Otherwise.
+ */
+bool MacroEngine::FitsBlocks(const unsigned BLOCK_SIZE, const unsigned RADIX) {
+  if (BLOCK_SIZE > 16) {
+    return false;
+  }
+  std::uint64_t blocks{1};
+  for (unsigned i{0}; i < BLOCK_SIZE; ++i) {
+    blocks *= RADIX;
+    if (blocks > SymbolTable::MAX_SYMBOLS) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the number of slots of the table of memoized macro steps of a DTM: one per state, block and side.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param TAPE Macro tape of the DTM.
+ * @return The number of slots, or 0 if they do not fit in MAX_DENSE_STEPS and the steps are memoized in a hash table.
+ */
+std::uint64_t MacroEngine::DenseSteps(const DispatchTable& TABLE, const MacroTape& TAPE) {
+  const std::uint64_t SLOTS{TABLE.NumberOfStates() * TAPE.NumberOfBlocks() * 2};
+  return SLOTS <= MAX_DENSE_STEPS ? SLOTS : 0;
+}
+
+/**
+ * @brief Runs the DTM on the macro tape of the execution context, one macro step at a time. At most
+ *        CompiledMachine::CHECK_INTERVAL macro steps are made per call, whatever the steps they add up to.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param context Execution context of the run. Its state, steps and memoized macro steps are updated.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return true If the DTM did not halt.
+ * @return false If the DTM halted.
+ */
+bool MacroEngine::Run(const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) {
+  MacroTape& tape{context.macroTapes[0]};
+  const unsigned LAST{tape.BlockSize() - 1};
+  unsigned state{context.state};
+  std::uint64_t steps{0};
+  bool halted{false};
+  for (std::uint64_t operations{0}; operations < CompiledMachine::CHECK_INTERVAL && steps < MAX_STEPS && !halted; ++operations) {
+    const std::uint64_t REMAINING{MAX_STEPS - steps};
+    const unsigned OFFSET{tape.Offset()};
+    if (OFFSET != 0 && OFFSET != LAST) {
+      const MacroStep STEP{Simulate(TABLE, tape, state, REMAINING)};
+      tape.Apply(STEP);
+      steps += STEP.steps;
+      state = STEP.state;
+      halted = STEP.halted;
+      continue;
+    }
+    const std::uint64_t INDEX{(state * tape.NumberOfBlocks() + tape.Block()) * 2 + (OFFSET != 0)};
+    MacroStep& memo{context.denseMacroSteps.empty() ? context.sparseMacroSteps[INDEX] : context.denseMacroSteps[INDEX]};
+    if ((memo.steps == 0 && !memo.halted) || memo.steps > REMAINING) {
+      const MacroStep STEP{Simulate(TABLE, tape, state, REMAINING)};
+      if (!STEP.halted && STEP.offset >= 0 && STEP.offset <= static_cast<int>(LAST)) {
+        tape.Apply(STEP);
+        steps += STEP.steps;
+        state = STEP.state;
+        continue;
+      }
+      memo = STEP;
+    }
+    const MacroStep STEP{memo};
+    const bool CROSSES{STEP.state == state && !STEP.halted && ((OFFSET == 0 && STEP.offset > static_cast<int>(LAST)) || (OFFSET == LAST && STEP.offset < 0))};
+    if (CROSSES) {
+      steps += tape.Chain(STEP, REMAINING / STEP.steps) * STEP.steps;
+    } else {
+      tape.Apply(STEP);
+      steps += STEP.steps;
+    }
+    state = STEP.state;
+    halted = STEP.halted;
+  }
+  context.state = state;
+  context.steps += steps;
+  return !halted;
+}
+
+/**
+ * @brief Runs the DTM cell by cell inside the block under the head until the head leaves the block, the DTM halts or
+ *        MAX_STEPS steps are made.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param TAPE Macro tape whose head starts the simulation.
+ * @param STATE Index of the state the simulation starts from.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return The macro step made.
+ */
+MacroStep MacroEngine::Simulate(const DispatchTable& TABLE, const MacroTape& TAPE, const StateId STATE, const std::uint64_t MAX_STEPS) {
+  const int BLOCK_SIZE{static_cast<int>(TAPE.BlockSize())};
+  MacroStep step{TAPE.Block(), STATE, static_cast<int>(TAPE.Offset()), 0, static_cast<int>(TAPE.Offset()), static_cast<int>(TAPE.Offset()), false};
+  while (step.steps < MAX_STEPS) {
+    const SymbolCode READ{(TABLE.ReadMask(step.state) & 1) ? TAPE.Digit(step.block, step.offset) : SymbolCode{0}};
+    const unsigned SLOT{TABLE.Lookup(step.state, TABLE.Extend(0, READ))};
+    if (SLOT == DispatchTable::HALT) {
+      step.halted = true;
+      break;
+    }
+    const CompiledTransition& TRANSITION{TABLE.Transition(SLOT)};
+    if (TRANSITION.writeSymbols[0] != SymbolTable::ANY) {
+      step.block = TAPE.WithDigit(step.block, step.offset, TRANSITION.writeSymbols[0]);
+    }
+    step.offset += TRANSITION.movements[0] == Movement::LEFT ? -1 : TRANSITION.movements[0] == Movement::RIGHT ? 1 : 0;
+    step.lowest = std::min(step.lowest, step.offset);
+    step.highest = std::max(step.highest, step.offset);
+    step.state = TRANSITION.nextState;
+    ++step.steps;
+    if (step.offset < 0 || step.offset >= BLOCK_SIZE) {
+      break;
+    }
+  }
+  return step;
+}
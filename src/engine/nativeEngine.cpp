@@ -0,0 +1,304 @@
+/**
+ * @file nativeEngine.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to run a DTM transpiled to C++ and compiled into a shared object.
+ * @date 17/10/2026
+ */
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+#include "../../include/engine/nativeEngine.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define NATIVE_ENGINE_DLOPEN
+#include <dlfcn.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Name of the function exported by the shared objects.
+ */
+const std::string NativeEngine::SYMBOL_NAME{"dtm_run"};
+
+/**
+ * @brief Returns the 64-bit FNV-1a hash of a string.
+ */
+static std::uint64_t Hash(const std::string& TEXT) {
+  std::uint64_t hash{0xcbf29ce484222325u};
+  for (const unsigned char CHARACTER : TEXT) {
+    hash = (hash ^ CHARACTER) * 0x100000001b3u;
+  }
+  return hash;
+}
+
+/**
+ * @brief Returns the statements that store the locals of a tape back into its view.
+ */
+static std::string SaveTape(const unsigned TAPE) {
+  const std::string I{std::to_string(TAPE)};
+  return "run->tapes[" + I + "].head = h" + I + "; run->tapes[" + I + "].leftmost = l" + I + "; run->tapes[" + I + "].rightmost = r" + I + ";";
+}
+
+/**
+ * @brief Returns the statements that load the view of a tape into its locals.
+ */
+static std::string LoadTape(const unsigned TAPE) {
+  const std::string I{std::to_string(TAPE)};
+  return "c" + I + " = reinterpret_cast<Cell*>(run->tapes[" + I + "].cells); n" + I + " = run->tapes[" + I + "].size; h" + I + " = run->tapes[" + I + "].head; l" + I +
+         " = run->tapes[" + I + "].leftmost; r" + I + " = run->tapes[" + I + "].rightmost;";
+}
+
+/**
+ * @brief Emits the straight-line code of a transition: writes, movements (growing the tapes when needed), step count
+ *        and jump to the next state. Cells written with SymbolTable::ANY are kept.
+ */
+static void EmitTransition(std::ostringstream& source, const CompiledTransition& TRANSITION, const std::string& INDENT) {
+  for (unsigned i{0}; i < TRANSITION.movements.size(); ++i) {
+    const std::string I{std::to_string(i)};
+    if (TRANSITION.writeSymbols[i] != SymbolTable::ANY && TRANSITION.writeSymbols[i] != TRANSITION.readSymbols[i]) {
+      source << INDENT << "c" << I << "[h" << I << "] = " << static_cast<unsigned>(TRANSITION.writeSymbols[i]) << ";\n";
+    }
+    const std::string GROW{SaveTape(i) + " run->grow(run->host, " + I + "); " + LoadTape(i)};
+    if (TRANSITION.movements[i] == Movement::LEFT) {
+      source << INDENT << "if (--h" << I << " < l" << I << ") { l" << I << " = h" << I << "; if (h" << I << " == 0) { " << GROW << " } }\n";
+    } else if (TRANSITION.movements[i] == Movement::RIGHT) {
+      source << INDENT << "if (++h" << I << " > r" << I << ") { r" << I << " = h" << I << "; if (h" << I << " == n" << I << " - 1) { " << GROW << " } }\n";
+    }
+  }
+  source << INDENT << "if (++steps == MAX_STEPS) { run->state = " << TRANSITION.nextState << "; goto budget; }\n";
+  source << INDENT << "goto S" << TRANSITION.nextState << ";\n";
+}
+
+/**
+ * @brief Emits the switch over the symbol read from a tape that selects among transitions of a state sharing the
+ *        symbols read from the previous tapes. Symbols without a transition fall through to the wildcard rows of the
+ *        state. Tapes the state does not read are not switched on.
+ */
+static void EmitDispatch(std::ostringstream& source, const DispatchTable& TABLE, const std::vector<unsigned>& SLOTS, const unsigned TAPE, const std::string& INDENT) {
+  if (TAPE == TABLE.Transition(SLOTS.front()).readSymbols.size()) {
+    EmitTransition(source, TABLE.Transition(SLOTS.front()), INDENT);
+    return;
+  }
+  if (TABLE.Transition(SLOTS.front()).readSymbols[TAPE] == SymbolTable::ANY) {
+    EmitDispatch(source, TABLE, SLOTS, TAPE + 1, INDENT);
+    return;
+  }
+  std::map<unsigned, std::vector<unsigned>> bySymbol;
+  for (const auto& SLOT : SLOTS) {
+    bySymbol[TABLE.Transition(SLOT).readSymbols[TAPE]].emplace_back(SLOT);
+  }
+  source << INDENT << "switch (c" << TAPE << "[h" << TAPE << "]) {\n";
+  for (const auto& [SYMBOL, SYMBOL_SLOTS] : bySymbol) {
+    source << INDENT << "  case " << SYMBOL << ":\n";
+    EmitDispatch(source, TABLE, SYMBOL_SLOTS, TAPE + 1, INDENT + "    ");
+    if (TAPE + 1 < TABLE.Transition(SYMBOL_SLOTS.front()).readSymbols.size()) {
+      source << INDENT << "    break;\n";
+    }
+  }
+  source << INDENT << "  default:\n" << INDENT << "    break;\n" << INDENT << "}\n";
+}
+
+/**
+ * @brief Emits the wildcard rows of a state, tested one after another in the order they take precedence, so a row
+ *        costs one test per symbol it reads instead of one case per combination of the symbols it does not.
+ */
+static void EmitWildcardRows(std::ostringstream& source, const DispatchTable& TABLE, const unsigned STATE, const std::string& INDENT) {
+  for (unsigned row{TABLE.WildcardRowsBegin(STATE)}; row < TABLE.WildcardRowsEnd(STATE); ++row) {
+    const CompiledTransition& ROW{TABLE.WildcardRow(row)};
+    std::string condition;
+    for (unsigned i{0}; i < ROW.readSymbols.size(); ++i) {
+      if (ROW.readSymbols[i] != SymbolTable::ANY) {
+        condition += (condition.empty() ? "" : " && ") + std::string{"c"} + std::to_string(i) + "[h" + std::to_string(i) + "] == " + std::to_string(ROW.readSymbols[i]);
+      }
+    }
+    source << INDENT << (condition.empty() ? "" : "if (" + condition + ") ") << "{\n";
+    EmitTransition(source, ROW, INDENT + "  ");
+    source << INDENT << "}\n";
+  }
+}
+
+/**
+ * @brief Transpiles a DTM into a C++ translation unit that exports the function SYMBOL_NAME (see NativeRun). The
+ *        transitions without wildcard reads are dispatched by nested switches and the wildcard rows are tested after
+ *        them, so the code grows with the transitions of the DTM and not with the combinations their wildcards expand to.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param NUMBER_OF_TAPES Number of tapes of the DTM.
+ * @param CELL_BITS Number of bits of a cell of the tapes: 8 or 16.
+ * @return The source code of the translation unit.
+ */
+std::string NativeEngine::Transpile(const DispatchTable& TABLE, const unsigned NUMBER_OF_TAPES, const unsigned CELL_BITS) {
+  std::vector<std::vector<unsigned>> slotsByState(TABLE.NumberOfStates());
+  for (unsigned slot{0}; slot < TABLE.NumberOfTransitions(); ++slot) {
+    if (!TABLE.Transition(slot).expanded) {
+      slotsByState[TABLE.Transition(slot).fromState].emplace_back(slot);
+    }
+  }
+  std::ostringstream source;
+  source << "// Generated by the native engine of the DTM simulator.\n"
+         << "#include <cstdint>\n\n"
+         << "struct RawTape { unsigned char* cells; std::uint64_t size; std::uint64_t head; std::uint64_t leftmost; std::uint64_t rightmost; };\n"
+         << "struct NativeRun { RawTape* tapes; void* host; void (*grow)(void*, unsigned); std::uint64_t maxSteps; std::uint64_t steps; unsigned state; };\n"
+         << "using Cell = std::uint" << CELL_BITS << "_t;\n\n"
+         << "extern \"C\" int " << SYMBOL_NAME << "(NativeRun* run) {\n"
+         << "  const std::uint64_t MAX_STEPS{run->maxSteps};\n"
+         << "  std::uint64_t steps{0};\n";
+  for (unsigned i{0}; i < NUMBER_OF_TAPES; ++i) {
+    source << "  Cell* c" << i << ";\n  std::uint64_t n" << i << ", h" << i << ", l" << i << ", r" << i << ";\n  " << LoadTape(i) << "\n";
+  }
+  source << "  switch (run->state) {\n";
+  for (unsigned state{0}; state < TABLE.NumberOfStates(); ++state) {
+    source << "    case " << state << ": goto S" << state << ";\n";
+  }
+  source << "  }\n";
+  for (unsigned state{0}; state < TABLE.NumberOfStates(); ++state) {
+    source << "S" << state << ":\n";
+    if (!slotsByState[state].empty()) {
+      EmitDispatch(source, TABLE, slotsByState[state], 0, "  ");
+    }
+    EmitWildcardRows(source, TABLE, state, "  ");
+    source << "  run->state = " << state << ";\n  goto halt;\n";
+  }
+  std::string saveAll;
+  for (unsigned i{0}; i < NUMBER_OF_TAPES; ++i) {
+    saveAll += "  " + SaveTape(i) + "\n";
+  }
+  source << "halt:\n" << saveAll << "  run->steps = steps;\n  return 1;\n"
+         << "budget:\n" << saveAll << "  run->steps = steps;\n  return 0;\n"
+         << "}\n";
+  return source.str();
+}
+
+/**
+ * @brief Returns the directory where the transpiled DTMs are cached by default: $XDG_CACHE_HOME/dtm, ~/.cache/dtm
+ *        or the temporary directory of the system, in that order.
+ *
+ * @return The path of the cache directory.
+ */
+std::string NativeEngine::DefaultCacheDirectory() {
+  if (const char* XDG_CACHE_HOME{std::getenv("XDG_CACHE_HOME")}; XDG_CACHE_HOME != nullptr && *XDG_CACHE_HOME != '\0') {
+    return (std::filesystem::path{XDG_CACHE_HOME} / "dtm").string();
+  }
+  if (const char* HOME{std::getenv("HOME")}; HOME != nullptr && *HOME != '\0') {
+    return (std::filesystem::path{HOME} / ".cache" / "dtm").string();
+  }
+  return (std::filesystem::temp_directory_path() / "dtm").string();
+}
+
+/**
+ * @brief Quotes a path for the shell: the path is enclosed in single quotes and every single quote in it is written as
+ *        '\'' (closing the quotes, an escaped quote and opening them again), so no character of the path is interpreted.
+ *
+ * @param PATH Path to quote.
+ * @return The quoted path.
+ */
+std::string NativeEngine::Quote(const std::string& PATH) {
+  std::string quoted{"'"};
+  for (const char CHARACTER : PATH) {
+    quoted += CHARACTER == '\'' ? std::string{"'\\''"} : std::string{CHARACTER};
+  }
+  return quoted + "'";
+}
+
+/**
+ * @brief Transpiles a DTM, compiles it unless it is already cached and loads the shared object.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param NUMBER_OF_TAPES Number of tapes of the DTM.
+ * @param CELL_BITS Number of bits of a cell of the tapes: 8 or 16.
+ * @param CACHE_DIRECTORY Directory where the generated sources and shared objects are kept.
+ * @throw std::runtime_error If the DTM cannot be compiled or loaded, or the platform has no dlopen.
+ */
+NativeEngine::NativeEngine(const DispatchTable& TABLE, const unsigned NUMBER_OF_TAPES, const unsigned CELL_BITS, const std::string& CACHE_DIRECTORY) : library{nullptr}, function{nullptr} {
+#ifdef NATIVE_ENGINE_DLOPEN
+  const std::string SOURCE{Transpile(TABLE, NUMBER_OF_TAPES, CELL_BITS)};
+  std::ostringstream name;
+  name << "dtm-" << std::hex << std::setw(16) << std::setfill('0') << Hash(SOURCE);
+  const std::string BASE{(std::filesystem::path{CACHE_DIRECTORY} / name.str()).string()};
+  const std::string LIBRARY_PATH{BASE + ".so"};
+  if (!std::filesystem::exists(LIBRARY_PATH)) {
+    std::filesystem::create_directories(CACHE_DIRECTORY);
+    const std::string TEMPORARY_BASE{BASE + "." + std::to_string(getpid())};
+    const std::string LOG_PATH{TEMPORARY_BASE + ".log"};
+    std::ofstream{TEMPORARY_BASE + ".cpp"} << SOURCE;
+    const char* COMPILER{std::getenv("CXX")};
+    const std::string COMMAND{std::string{COMPILER != nullptr ? COMPILER : "g++"} + " -std=c++17 -O2 -shared -fPIC -o " + Quote(TEMPORARY_BASE + ".so") + " " +
+                              Quote(TEMPORARY_BASE + ".cpp") + " 2> " + Quote(LOG_PATH)};
+    if (std::system(COMMAND.c_str()) != 0) {
+      std::error_code ignored;
+      std::filesystem::remove(TEMPORARY_BASE + ".cpp", ignored);
+      std::filesystem::remove(TEMPORARY_BASE + ".so", ignored);
+      std::filesystem::rename(LOG_PATH, BASE + ".log", ignored);
+      throw std::runtime_error{"Runtime error: Could not compile the native DTM (see " + BASE + ".log)"};
+    }
+    std::filesystem::remove(LOG_PATH);
+    std::filesystem::rename(TEMPORARY_BASE + ".cpp", BASE + ".cpp");
+    std::filesystem::rename(TEMPORARY_BASE + ".so", LIBRARY_PATH);
+  }
+  library = dlopen(LIBRARY_PATH.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (library == nullptr) {
+    throw std::runtime_error{"Runtime error: Could not load the native DTM (" + std::string{dlerror()} + ")"};
+  }
+  function = reinterpret_cast<NativeFunction>(dlsym(library, SYMBOL_NAME.c_str()));
+  if (function == nullptr) {
+    dlclose(library);
+    throw std::runtime_error{"Runtime error: Symbol " + SYMBOL_NAME + " not found in " + LIBRARY_PATH};
+  }
+#else
+  throw std::runtime_error{"Runtime error: The native engine is not supported on this platform"};
+#endif
+}
+
+/**
+ * @brief Runs the native code from the configuration stored in the execution context.
+ *
+ * @param TABLE Compiled transitions of the DTM the code was transpiled from, unused as the code already holds them.
+ * @param context Execution context of the run. Its state and steps are updated.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return true If the DTM made MAX_STEPS steps without halting.
+ * @return false If the DTM halted.
+ */
+bool NativeEngine::Run([[maybe_unused]] const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) const {
+  if (MAX_STEPS == 0) {
+    return true;
+  }
+  context.rawTapes.clear();
+  for (auto& TAPE : context.tapes) {
+    context.rawTapes.emplace_back(TAPE.Expose());
+  }
+  NativeRun run{context.rawTapes.data(), &context, &Grow, MAX_STEPS, 0, context.state};
+  const bool HALTED{function(&run) == 1};
+  for (unsigned i{0}; i < context.tapes.size(); ++i) {
+    context.tapes[i].Absorb(context.rawTapes[i]);
+  }
+  context.state = run.state;
+  context.steps += run.steps;
+  return !HALTED;
+}
+
+/**
+ * @brief Unloads the shared object.
+ */
+NativeEngine::~NativeEngine() {
+#ifdef NATIVE_ENGINE_DLOPEN
+  dlclose(library);
+#endif
+}
+
+/**
+ * @brief Grows a tape whose head reached its first or last cell while running native code and refreshes its view.
+ *
+ * @param host Execution context of the run.
+ * @param TAPE Index of the tape.
+ */
+void NativeEngine::Grow(void* host, const unsigned TAPE) {
+  ExecutionContext& context{*static_cast<ExecutionContext*>(host)};
+  context.tapes[TAPE].Absorb(context.rawTapes[TAPE]);
+  context.rawTapes[TAPE] = context.tapes[TAPE].Expose();
+}
@@ -0,0 +1,87 @@
+/**
+ * @file runLengthEngine.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to run a DTM on run-length encoded tapes.
+ * @date 17/10/2026
+ */
+
+#include "../../include/engine/runLengthEngine.hpp"
+#include "../../include/structure/compiledMachine.hpp"
+
+/**
+ * @brief Finds the sweeps among the compiled transitions of a DTM.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ */
+RunLengthEngine::RunLengthEngine(const DispatchTable& TABLE) {
+  for (unsigned slot{0}; slot < TABLE.NumberOfTransitions(); ++slot) {
+    sweepTapes.emplace_back(SweepTape(TABLE.Transition(slot)));
+  }
+}
+
+/**
+ * @brief Runs the DTM on the run-length tapes of the execution context, crossing whole runs on sweeps. At most
+ *        CompiledMachine::CHECK_INTERVAL transitions or sweeps are applied per call, whatever the steps they add up to.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ * @param context Execution context of the run. Its state and steps are updated.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return true If the DTM did not halt.
+ * @return false If the DTM halted.
+ */
+bool RunLengthEngine::Run(const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) const {
+  std::vector<RunLengthTape>& tapes{context.runTapes};
+  unsigned state{context.state};
+  std::uint64_t steps{0};
+  for (std::uint64_t operations{0}; operations < CompiledMachine::CHECK_INTERVAL && steps < MAX_STEPS; ++operations) {
+    const std::uint64_t KEY{TABLE.Key(state, tapes)};
+    const unsigned SLOT{TABLE.Lookup(state, KEY)};
+    if (SLOT == DispatchTable::HALT) {
+      context.state = state;
+      context.steps += steps;
+      return false;
+    }
+    const CompiledTransition& TRANSITION{TABLE.Transition(SLOT)};
+    const int SWEEP_TAPE{sweepTapes[SLOT]};
+    if (SWEEP_TAPE != -1) {
+      steps += tapes[SWEEP_TAPE].Cross(TRANSITION.movements[SWEEP_TAPE], TRANSITION.writeSymbols[SWEEP_TAPE], MAX_STEPS - steps);
+      continue;
+    }
+    for (unsigned i{0}; i < tapes.size(); ++i) {
+      if (TRANSITION.writeSymbols[i] != SymbolTable::ANY) {
+        tapes[i].Write(TRANSITION.writeSymbols[i]);
+      }
+      tapes[i].MoveHead(TRANSITION.movements[i]);
+    }
+    state = TRANSITION.nextState;
+    ++steps;
+  }
+  context.state = state;
+  context.steps += steps;
+  return true;
+}
+
+/**
+ * @brief Checks if a transition is a sweep: it loops on its state, moves a single tape and, on every other tape, reads
+ *        a symbol and writes it back or keeps the cell.
+ *
+ * @param TRANSITION Transition to check.
+ * @return The index of the tape moved by the sweep, or -1 if the transition is not a sweep.
+ */
+int RunLengthEngine::SweepTape(const CompiledTransition& TRANSITION) {
+  if (TRANSITION.nextState != TRANSITION.fromState) {
+    return -1;
+  }
+  int sweepTape{-1};
+  for (unsigned i{0}; i < TRANSITION.movements.size(); ++i) {
+    if (TRANSITION.movements[i] != Movement::STAY) {
+      if (sweepTape != -1) {
+        return -1;
+      }
+      sweepTape = i;
+    } else if (TRANSITION.writeSymbols[i] != SymbolTable::ANY && TRANSITION.writeSymbols[i] != TRANSITION.readSymbols[i]) {
+      return -1;
+    }
+  }
+  return sweepTape;
+}
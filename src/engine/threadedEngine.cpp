@@ -0,0 +1,170 @@
+/**
+ * @file threadedEngine.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to run a DTM lowered into threaded code.
+ * @date 17/10/2026
+ */
+
+#include "../../include/engine/threadedEngine.hpp"
+
+#if defined(__GNUC__)
+#define THREADED_COMPUTED_GOTO
+#endif
+
+/**
+ * @brief Lowers the compiled transitions of a DTM into threaded code.
+ *
+ * @param TABLE Compiled transitions of the DTM.
+ */
+ThreadedEngine::ThreadedEngine(const DispatchTable& TABLE) {
+  for (unsigned i{0}; i < TABLE.NumberOfStates(); ++i) {
+    blocks.emplace_back(code.size());
+    code.emplace_back(ThreadedInstruction{ThreadedOpcode::DISPATCH, 0, i, 0});
+  }
+  for (unsigned slot{0}; slot < TABLE.NumberOfTransitions(); ++slot) {
+    const CompiledTransition& TRANSITION{TABLE.Transition(slot)};
+    entries.emplace_back(code.size());
+    if (TRANSITION.scanTape != -1) {
+      code.emplace_back(ThreadedInstruction{ThreadedOpcode::SCAN, static_cast<unsigned>(TRANSITION.scanTape), slot, 0});
+    }
+    for (unsigned i{0}; i < TRANSITION.movements.size(); ++i) {
+      if (TRANSITION.writeSymbols[i] != TRANSITION.readSymbols[i]) {
+        code.emplace_back(ThreadedInstruction{ThreadedOpcode::WRITE, i, 0, TRANSITION.writeSymbols[i]});
+      }
+      if (TRANSITION.movements[i] == Movement::LEFT) {
+        code.emplace_back(ThreadedInstruction{ThreadedOpcode::MOVE_LEFT, i, 0, 0});
+      } else if (TRANSITION.movements[i] == Movement::RIGHT) {
+        code.emplace_back(ThreadedInstruction{ThreadedOpcode::MOVE_RIGHT, i, 0, 0});
+      }
+    }
+    code.emplace_back(ThreadedInstruction{ThreadedOpcode::JUMP, 0, TRANSITION.nextState, 0});
+  }
+}
+
+/**
+ * @brief Runs the threaded code from the configuration stored in the execution context.
+ *
+ * @param TABLE Compiled transitions of the DTM the code was lowered from.
+ * @param context Execution context of the run. Its state and steps are updated.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @return true If the DTM made MAX_STEPS steps without halting.
+ * @return false If the DTM halted.
+ */
+bool ThreadedEngine::Run(const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) const {
+  std::vector<Tape>& tapes{context.tapes};
+  unsigned state{context.state};
+  std::uint64_t steps{0};
+  if (MAX_STEPS == 0) {
+    return true;
+  }
+  const ThreadedInstruction* instruction{&code[blocks[state]]};
+#ifdef THREADED_COMPUTED_GOTO
+  static const void* const LABELS[]{&&DISPATCH, &&SCAN, &&WRITE, &&MOVE_LEFT, &&MOVE_RIGHT, &&JUMP};
+  goto *LABELS[static_cast<unsigned>(instruction->opcode)];
+  DISPATCH: {
+    state = instruction->operand;
+    const unsigned SLOT{TABLE.Lookup(state, TABLE.Key(state, tapes))};
+    if (SLOT == DispatchTable::HALT) {
+      context.state = state;
+      context.steps += steps;
+      return false;
+    }
+    instruction = &code[entries[SLOT]];
+    goto *LABELS[static_cast<unsigned>(instruction->opcode)];
+  }
+  SCAN: {
+    const CompiledTransition& TRANSITION{TABLE.Transition(instruction->operand)};
+    const std::uint64_t SCANNED{tapes[instruction->tape].Scan(TRANSITION.scanSymbols, TRANSITION.movements[instruction->tape], MAX_STEPS - steps)};
+    if (SCANNED > 0) {
+      steps += SCANNED;
+      if (steps == MAX_STEPS) {
+        context.state = state;
+        context.steps += steps;
+        return true;
+      }
+      instruction = &code[blocks[state]];
+    } else {
+      ++instruction;
+    }
+    goto *LABELS[static_cast<unsigned>(instruction->opcode)];
+  }
+  WRITE: {
+    tapes[instruction->tape].Write(instruction->symbol);
+    ++instruction;
+    goto *LABELS[static_cast<unsigned>(instruction->opcode)];
+  }
+  MOVE_LEFT: {
+    tapes[instruction->tape].MoveHead(Movement::LEFT);
+    ++instruction;
+    goto *LABELS[static_cast<unsigned>(instruction->opcode)];
+  }
+  MOVE_RIGHT: {
+    tapes[instruction->tape].MoveHead(Movement::RIGHT);
+    ++instruction;
+    goto *LABELS[static_cast<unsigned>(instruction->opcode)];
+  }
+  JUMP: {
+    state = instruction->operand;
+    if (++steps == MAX_STEPS) {
+      context.state = state;
+      context.steps += steps;
+      return true;
+    }
+    instruction = &code[blocks[state]];
+    goto *LABELS[static_cast<unsigned>(instruction->opcode)];
+  }
+#else
+  while (true) {
+    switch (instruction->opcode) {
+      case ThreadedOpcode::DISPATCH: {
+        state = instruction->operand;
+        const unsigned SLOT{TABLE.Lookup(state, TABLE.Key(state, tapes))};
+        if (SLOT == DispatchTable::HALT) {
+          context.state = state;
+          context.steps += steps;
+          return false;
+        }
+        instruction = &code[entries[SLOT]];
+        break;
+      }
+      case ThreadedOpcode::SCAN: {
+        const CompiledTransition& TRANSITION{TABLE.Transition(instruction->operand)};
+        const std::uint64_t SCANNED{tapes[instruction->tape].Scan(TRANSITION.scanSymbols, TRANSITION.movements[instruction->tape], MAX_STEPS - steps)};
+        if (SCANNED > 0) {
+          steps += SCANNED;
+          if (steps == MAX_STEPS) {
+            context.state = state;
+            context.steps += steps;
+            return true;
+          }
+          instruction = &code[blocks[state]];
+        } else {
+          ++instruction;
+        }
+        break;
+      }
+      case ThreadedOpcode::WRITE:
+        tapes[instruction->tape].Write(instruction->symbol);
+        ++instruction;
+        break;
+      case ThreadedOpcode::MOVE_LEFT:
+        tapes[instruction->tape].MoveHead(Movement::LEFT);
+        ++instruction;
+        break;
+      case ThreadedOpcode::MOVE_RIGHT:
+        tapes[instruction->tape].MoveHead(Movement::RIGHT);
+        ++instruction;
+        break;
+      case ThreadedOpcode::JUMP:
+        state = instruction->operand;
+        if (++steps == MAX_STEPS) {
+          context.state = state;
+          context.steps += steps;
+          return true;
+        }
+        instruction = &code[blocks[state]];
+        break;
+    }
+  }
+#endif
+}
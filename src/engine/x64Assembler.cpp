@@ -0,0 +1,265 @@
+/**
+ * @file x64Assembler.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to encode the x86-64 instructions emitted by the JIT engine.
+ * @date 17/10/2026
+ */
+
+#include "../../include/engine/x64Assembler.hpp"
+
+/**
+ * @brief Creates a label to be bound later.
+ *
+ * @return The identifier of the label.
+ */
+unsigned X64Assembler::NewLabel() {
+  labels.emplace_back(0);
+  return labels.size() - 1;
+}
+
+/**
+ * @brief Binds a label to the current position of the code.
+ *
+ * @param LABEL Label to bind.
+ */
+void X64Assembler::Bind(const unsigned LABEL) {
+  labels[LABEL] = code.size();
+}
+
+/**
+ * @brief Emits a jump (jmp or jcc rel32) to a label.
+ *
+ * @param CONDITION Condition of the jump.
+ * @param LABEL Target of the jump.
+ */
+void X64Assembler::Jump(const Condition CONDITION, const unsigned LABEL) {
+  if (CONDITION == Condition::ALWAYS) {
+    code.emplace_back(0xE9);
+  } else {
+    code.emplace_back(0x0F);
+    code.emplace_back(static_cast<unsigned char>(CONDITION));
+  }
+  fixups.emplace_back(code.size(), LABEL);
+  Immediate(0);
+}
+
+/**
+ * @brief Emits push r64.
+ */
+void X64Assembler::Push(const Register REGISTER) {
+  Rex(false, 0, static_cast<unsigned>(REGISTER));
+  code.emplace_back(0x50 | (static_cast<unsigned>(REGISTER) & 7));
+}
+
+/**
+ * @brief Emits pop r64.
+ */
+void X64Assembler::Pop(const Register REGISTER) {
+  Rex(false, 0, static_cast<unsigned>(REGISTER));
+  code.emplace_back(0x58 | (static_cast<unsigned>(REGISTER) & 7));
+}
+
+/**
+ * @brief Emits mov r64, r64.
+ */
+void X64Assembler::Move(const Register DESTINATION, const Register SOURCE) {
+  Rex(true, static_cast<unsigned>(SOURCE), static_cast<unsigned>(DESTINATION));
+  code.emplace_back(0x89);
+  code.emplace_back(0xC0 | ((static_cast<unsigned>(SOURCE) & 7) << 3) | (static_cast<unsigned>(DESTINATION) & 7));
+}
+
+/**
+ * @brief Emits mov r32, imm32, which clears the upper half of the register.
+ */
+void X64Assembler::Move(const Register DESTINATION, const std::uint32_t VALUE) {
+  Rex(false, 0, static_cast<unsigned>(DESTINATION));
+  code.emplace_back(0xB8 | (static_cast<unsigned>(DESTINATION) & 7));
+  Immediate(VALUE);
+}
+
+/**
+ * @brief Emits mov r64, [base + disp32].
+ */
+void X64Assembler::Load(const Register DESTINATION, const Register BASE, const std::int32_t DISPLACEMENT) {
+  Rex(true, static_cast<unsigned>(DESTINATION), static_cast<unsigned>(BASE));
+  code.emplace_back(0x8B);
+  Operand(static_cast<unsigned>(DESTINATION), BASE, DISPLACEMENT);
+}
+
+/**
+ * @brief Emits mov r32, [base + disp32].
+ */
+void X64Assembler::Load32(const Register DESTINATION, const Register BASE, const std::int32_t DISPLACEMENT) {
+  Rex(false, static_cast<unsigned>(DESTINATION), static_cast<unsigned>(BASE));
+  code.emplace_back(0x8B);
+  Operand(static_cast<unsigned>(DESTINATION), BASE, DISPLACEMENT);
+}
+
+/**
+ * @brief Emits movzx r32, byte [base + disp32].
+ */
+void X64Assembler::LoadByte(const Register DESTINATION, const Register BASE, const std::int32_t DISPLACEMENT) {
+  Rex(false, static_cast<unsigned>(DESTINATION), static_cast<unsigned>(BASE));
+  code.emplace_back(0x0F);
+  code.emplace_back(0xB6);
+  Operand(static_cast<unsigned>(DESTINATION), BASE, DISPLACEMENT);
+}
+
+/**
+ * @brief Emits mov [base + disp32], r64.
+ */
+void X64Assembler::Store(const Register BASE, const std::int32_t DISPLACEMENT, const Register SOURCE) {
+  Rex(true, static_cast<unsigned>(SOURCE), static_cast<unsigned>(BASE));
+  code.emplace_back(0x89);
+  Operand(static_cast<unsigned>(SOURCE), BASE, DISPLACEMENT);
+}
+
+/**
+ * @brief Emits mov dword [base + disp32], imm32.
+ */
+void X64Assembler::Store32(const Register BASE, const std::int32_t DISPLACEMENT, const std::uint32_t VALUE) {
+  Rex(false, 0, static_cast<unsigned>(BASE));
+  code.emplace_back(0xC7);
+  Operand(0, BASE, DISPLACEMENT);
+  Immediate(VALUE);
+}
+
+/**
+ * @brief Emits mov byte [base + disp32], imm8.
+ */
+void X64Assembler::StoreByte(const Register BASE, const std::int32_t DISPLACEMENT, const std::uint8_t VALUE) {
+  Rex(false, 0, static_cast<unsigned>(BASE));
+  code.emplace_back(0xC6);
+  Operand(0, BASE, DISPLACEMENT);
+  code.emplace_back(VALUE);
+}
+
+/**
+ * @brief Emits cmp r64, [base + disp32].
+ */
+void X64Assembler::Compare(const Register REGISTER, const Register BASE, const std::int32_t DISPLACEMENT) {
+  Rex(true, static_cast<unsigned>(REGISTER), static_cast<unsigned>(BASE));
+  code.emplace_back(0x3B);
+  Operand(static_cast<unsigned>(REGISTER), BASE, DISPLACEMENT);
+}
+
+/**
+ * @brief Emits cmp r32, imm32.
+ */
+void X64Assembler::Compare(const Register REGISTER, const std::uint32_t VALUE) {
+  Rex(false, 0, static_cast<unsigned>(REGISTER));
+  code.emplace_back(0x81);
+  code.emplace_back(0xF8 | (static_cast<unsigned>(REGISTER) & 7));
+  Immediate(VALUE);
+}
+
+/**
+ * @brief Emits cmp al, imm8.
+ */
+void X64Assembler::CompareAl(const std::uint8_t VALUE) {
+  code.emplace_back(0x3C);
+  code.emplace_back(VALUE);
+}
+
+/**
+ * @brief Emits add r64, imm8 (sign extended).
+ */
+void X64Assembler::Add(const Register REGISTER, const std::int8_t VALUE) {
+  Rex(true, 0, static_cast<unsigned>(REGISTER));
+  code.emplace_back(0x83);
+  code.emplace_back(0xC0 | (static_cast<unsigned>(REGISTER) & 7));
+  code.emplace_back(static_cast<unsigned char>(VALUE));
+}
+
+/**
+ * @brief Emits sub r64, r64.
+ */
+void X64Assembler::Subtract(const Register DESTINATION, const Register SOURCE) {
+  Rex(true, static_cast<unsigned>(SOURCE), static_cast<unsigned>(DESTINATION));
+  code.emplace_back(0x29);
+  code.emplace_back(0xC0 | ((static_cast<unsigned>(SOURCE) & 7) << 3) | (static_cast<unsigned>(DESTINATION) & 7));
+}
+
+/**
+ * @brief Emits inc r64.
+ */
+void X64Assembler::Increment(const Register REGISTER) {
+  Rex(true, 0, static_cast<unsigned>(REGISTER));
+  code.emplace_back(0xFF);
+  code.emplace_back(0xC0 | (static_cast<unsigned>(REGISTER) & 7));
+}
+
+/**
+ * @brief Emits dec r64.
+ */
+void X64Assembler::Decrement(const Register REGISTER) {
+  Rex(true, 0, static_cast<unsigned>(REGISTER));
+  code.emplace_back(0xFF);
+  code.emplace_back(0xC8 | (static_cast<unsigned>(REGISTER) & 7));
+}
+
+/**
+ * @brief Emits call qword [base + disp32].
+ */
+void X64Assembler::Call(const Register BASE, const std::int32_t DISPLACEMENT) {
+  Rex(false, 0, static_cast<unsigned>(BASE));
+  code.emplace_back(0xFF);
+  Operand(2, BASE, DISPLACEMENT);
+}
+
+/**
+ * @brief Emits ret.
+ */
+void X64Assembler::Return() {
+  code.emplace_back(0xC3);
+}
+
+/**
+ * @brief Returns the encoded code with the jumps patched to their labels.
+ *
+ * @return The machine code.
+ */
+std::vector<unsigned char> X64Assembler::Code() const {
+  std::vector<unsigned char> result{code};
+  for (const auto& [POSITION, LABEL] : fixups) {
+    const std::uint32_t OFFSET{static_cast<std::uint32_t>(static_cast<std::int64_t>(labels[LABEL]) - static_cast<std::int64_t>(POSITION + 4))};
+    for (unsigned i{0}; i < 4; ++i) {
+      result[POSITION + i] = static_cast<unsigned char>(OFFSET >> (8 * i));
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Emits the REX prefix needed by an instruction, if any.
+ *
+ * @param WIDE Whether the operation is 64 bits wide (REX.W).
+ * @param REGISTER Register of the ModRM reg field (REX.R).
+ * @param BASE Register of the ModRM rm field (REX.B).
+ */
+void X64Assembler::Rex(const bool WIDE, const unsigned REGISTER, const unsigned BASE) {
+  const unsigned char REX{static_cast<unsigned char>(0x40 | (WIDE << 3) | ((REGISTER >= 8) << 2) | (BASE >= 8))};
+  if (REX != 0x40) {
+    code.emplace_back(REX);
+  }
+}
+
+/**
+ * @brief Emits the ModRM byte (and the SIB byte for rsp and r12) of a [base + disp32] operand and its displacement.
+ */
+void X64Assembler::Operand(const unsigned REGISTER, const Register BASE, const std::int32_t DISPLACEMENT) {
+  code.emplace_back(0x80 | ((REGISTER & 7) << 3) | (static_cast<unsigned>(BASE) & 7));
+  if ((static_cast<unsigned>(BASE) & 7) == 4) {
+    code.emplace_back(0x24);
+  }
+  Immediate(static_cast<std::uint32_t>(DISPLACEMENT));
+}
+
+/**
+ * @brief Emits a little-endian 32-bit immediate.
+ */
+void X64Assembler::Immediate(const std::uint32_t VALUE) {
+  for (unsigned i{0}; i < 4; ++i) {
+    code.emplace_back(static_cast<unsigned char>(VALUE >> (8 * i)));
+  }
+}
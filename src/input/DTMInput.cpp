@@ -7,6 +7,16 @@
 
 #include "../../include/input/DTMInput.hpp"
 
+/**
+ * @brief Read symbol of the transitions that matches any symbol of the tape.
+ */
+const Symbol DTMInput::WILDCARD{'*'};
+
+/**
+ * @brief Write symbol of the transitions that keeps the symbol of the tape.
+ */
+const Symbol DTMInput::KEEP{'='};
+
 /**
  * @brief Reads a DTM from a file. The format is specified in the class documentation.
  * 
@@ -26,12 +36,19 @@ DTM DTMInput::ReadDTM(const std::string& JSON_FILENAME) {
     throw std::invalid_argument{"Reading file error: " + std::string{ERROR.what()}};
   }
   const Symbol BLANK_SYMBOL{json["blankSymbol"]};
-  std::map<std::string, State*> states;
+  StateArena states;
   for (const auto& STATE : json["states"]) {
-    states.emplace(STATE, new State{STATE});
+    states.Add(STATE);
   }
+  const std::string INPUT_SEPARATOR{json.value("inputSeparator", std::string{})};
   Alphabet tapeAlphabet;
   for (const auto& SYMBOL : json["tapeAlphabet"]) {
+    if (SYMBOL.get<std::string>().empty()) {
+      throw std::invalid_argument{"Reading file error: Tape alphabet cannot contain empty symbols"};
+    }
+    if (Symbol{SYMBOL} == WILDCARD || Symbol{SYMBOL} == KEEP) {
+      throw std::invalid_argument{"Reading file error: Tape alphabet cannot contain the symbols '" + WILDCARD.ToString() + "' and '" + KEEP.ToString() + "', reserved for transitions"};
+    }
     tapeAlphabet.insert(Symbol{SYMBOL});
   }
   if (tapeAlphabet.find(BLANK_SYMBOL) == tapeAlphabet.end()) {
@@ -46,47 +63,58 @@ DTM DTMInput::ReadDTM(const std::string& JSON_FILENAME) {
     if (tapeAlphabet.find(TO_ADD) == tapeAlphabet.end()) {
       throw std::invalid_argument{"Reading file error: Input symbol: '" + SYMBOL.get<std::string>() + "' not found in tape alphabet ( " + AlphabetFormatting(tapeAlphabet) + ")"}; 
     }
+    if (INPUT_SEPARATOR.empty() && TO_ADD.Value().size() > 1) {
+      throw std::invalid_argument{"Reading file error: Input symbol: '" + TO_ADD.ToString() + "' has several characters, so the input strings need an input separator"};
+    }
+    if (!INPUT_SEPARATOR.empty() && TO_ADD.Value().find(INPUT_SEPARATOR) != std::string::npos) {
+      throw std::invalid_argument{"Reading file error: Input symbol: '" + TO_ADD.ToString() + "' contains the input separator '" + INPUT_SEPARATOR + "'"};
+    }
     alphabet.insert(TO_ADD);
   }
-  if (states.find(json["initialState"]) == states.end()) {
-    throw std::invalid_argument{"Reading file error: Initial state: '" + json["initialState"].get<std::string>() + "' not found in states ( " + StatesFormatting(states) + ")"}; 
+  if (!states.Contains(json["initialState"])) {
+    throw std::invalid_argument{"Reading file error: Initial state: '" + json["initialState"].get<std::string>() + "' not found in states ( " + states.ToString() + ")"}; 
   }
-  State* initialState{states[json["initialState"]]};
+  const StateId INITIAL_STATE{states.Id(json["initialState"])};
   for (const auto& STATE : json["finalStates"]) {
-    if (states.find(STATE) == states.end()) {
-      throw std::invalid_argument{"Reading file error: Final state: '" + STATE.get<std::string>() + "' not found in states ( " + StatesFormatting(states) + ")"}; 
+    if (!states.Contains(STATE)) {
+      throw std::invalid_argument{"Reading file error: Final state: '" + STATE.get<std::string>() + "' not found in states ( " + states.ToString() + ")"}; 
     }
-    states[STATE]->SetAsFinal();
+    states.At(states.Id(STATE)).SetAsFinal();
   }
   const unsigned NUMBER_OF_TAPES{json["numTapes"]};
-  const std::vector<JSON> TRANSITIONS = json["transitions"];
-  AddTransitions(states, TRANSITIONS, tapeAlphabet, NUMBER_OF_TAPES);
-  const std::vector<State*> STATES{std::accumulate(states.begin(), states.end(), std::vector<State*>{}, [](std::vector<State*>& ACCOUNT, const std::pair<std::string, State*>& PAIR) { ACCOUNT.emplace_back(PAIR.second); return ACCOUNT; })};
-  return DTM{STATES, alphabet, tapeAlphabet, initialState, BLANK_SYMBOL, NUMBER_OF_TAPES};
+  const SymbolTable SYMBOLS{tapeAlphabet, BLANK_SYMBOL};
+  TransitionTable transitions{NUMBER_OF_TAPES};
+  AddTransitions(transitions, json["transitions"], states, SYMBOLS, tapeAlphabet, NUMBER_OF_TAPES);
+  transitions.Compress(states.Size());
+  return DTM{states, transitions, alphabet, SYMBOLS, INITIAL_STATE, NUMBER_OF_TAPES, INPUT_SEPARATOR};
 }
 
 /**
- * @brief Adds the transitions to the states.
+ * @brief Adds the transitions to the transition table, interning their symbols. Wildcard reads and keep writes are
+ *        stored as SymbolTable::ANY.
  * 
- * @param STATES States to add the transitions
+ * @param transitions Transition table to add the transitions to.
  * @param JSON_TRANSITIONS Transitions to add.
+ * @param STATES States of the DTM.
+ * @param SYMBOLS Symbol table of the tape alphabet.
  * @param TAPE_ALPHABET Alphabet of the tape.
  * @param NUMBER_OF_TAPES Number of tapes of the DTM.
  * @throw std::invalid_argument If the transitions are invalid
  */
-void DTMInput::AddTransitions(std::map<std::string, State*>& states, const std::vector<JSON>& JSON_TRANSITIONS, const Alphabet& TAPE_ALPHABET, const unsigned NUMBER_OF_TAPES) {
+void DTMInput::AddTransitions(TransitionTable& transitions, const JSON& JSON_TRANSITIONS, const StateArena& states, const SymbolTable& SYMBOLS, const Alphabet& TAPE_ALPHABET, const unsigned NUMBER_OF_TAPES) {
+  std::vector<SymbolCode> readCodes, writeCodes;
   for (const auto& TRANSITION : JSON_TRANSITIONS) {
-    if (states.find(TRANSITION["fromState"]) == states.end()) {
-      throw std::invalid_argument{"Reading file error: From state: '" + TRANSITION["fromState"].get<std::string>() + "' not found in states ( " + StatesFormatting(states) + ")"};
+    if (!states.Contains(TRANSITION["fromState"])) {
+      throw std::invalid_argument{"Reading file error: From state: '" + TRANSITION["fromState"].get<std::string>() + "' not found in states ( " + states.ToString() + ")"};
     }
-    State* fromState{states[TRANSITION["fromState"]]};
-    if (states.find(TRANSITION["toState"]) == states.end()) {
-      throw std::invalid_argument{"Reading file error: To state: '" + TRANSITION["toState"].get<std::string>() + "' not found in states ( " + StatesFormatting(states) + ")"};
+    const StateId FROM_STATE{states.Id(TRANSITION["fromState"])};
+    if (!states.Contains(TRANSITION["toState"])) {
+      throw std::invalid_argument{"Reading file error: To state: '" + TRANSITION["toState"].get<std::string>() + "' not found in states ( " + states.ToString() + ")"};
     }
-    State* toState{states[TRANSITION["toState"]]};
+    const StateId TO_STATE{states.Id(TRANSITION["toState"])};
     const std::vector<Symbol> READ_SYMBOLS{std::accumulate(TRANSITION["readSymbols"].begin(), TRANSITION["readSymbols"].end(), std::vector<Symbol>{}, [](std::vector<Symbol>& ACCOUNT, const std::string& SYMBOL) { ACCOUNT.emplace_back(Symbol{SYMBOL}); return ACCOUNT; })};
     for (const auto& SYMBOL : READ_SYMBOLS) {
-      if (TAPE_ALPHABET.find(SYMBOL) == TAPE_ALPHABET.end()) {
+      if (SYMBOL != WILDCARD && TAPE_ALPHABET.find(SYMBOL) == TAPE_ALPHABET.end()) {
         throw std::invalid_argument{"Reading file error: Read symbol: '" + SYMBOL.ToString() + "' not found in tape alphabet ( " + AlphabetFormatting(TAPE_ALPHABET) + ")"};
       }
     }
@@ -95,7 +123,7 @@ void DTMInput::AddTransitions(std::map<std::string, State*>& states, const std::
     }
     const std::vector<Symbol> WRITE_SYMBOLS{std::accumulate(TRANSITION["writeSymbols"].begin(), TRANSITION["writeSymbols"].end(), std::vector<Symbol>{}, [](std::vector<Symbol>& ACCOUNT, const std::string& SYMBOL) { ACCOUNT.emplace_back(Symbol{SYMBOL}); return ACCOUNT; })};
     for (const auto& SYMBOL : WRITE_SYMBOLS) {
-      if (TAPE_ALPHABET.find(SYMBOL) == TAPE_ALPHABET.end()) {
+      if (SYMBOL != KEEP && TAPE_ALPHABET.find(SYMBOL) == TAPE_ALPHABET.end()) {
         throw std::invalid_argument{"Reading file error: Write symbol: '" + SYMBOL.ToString() + "' not found in tape alphabet ( " + AlphabetFormatting(TAPE_ALPHABET) + ")"};
       }
     }
@@ -111,7 +139,13 @@ void DTMInput::AddTransitions(std::map<std::string, State*>& states, const std::
     if (MOVEMENTS.size() != NUMBER_OF_TAPES) {
       throw std::invalid_argument{"Reading file error: Number of movements: " + std::to_string(MOVEMENTS.size()) + " does not match the number of tapes: " + std::to_string(NUMBER_OF_TAPES)};
     }
-    fromState->Transitions().AddTransition(READ_SYMBOLS, WRITE_SYMBOLS, MOVEMENTS, toState);
+    readCodes.clear();
+    writeCodes.clear();
+    for (unsigned i{0}; i < NUMBER_OF_TAPES; ++i) {
+      readCodes.emplace_back(READ_SYMBOLS[i] == WILDCARD ? SymbolTable::ANY : SYMBOLS.Code(READ_SYMBOLS[i]));
+      writeCodes.emplace_back(WRITE_SYMBOLS[i] == KEEP ? SymbolTable::ANY : SYMBOLS.Code(WRITE_SYMBOLS[i]));
+    }
+    transitions.Add(FROM_STATE, readCodes, writeCodes, MOVEMENTS, TO_STATE);
   }
 }
 
@@ -124,13 +158,3 @@ void DTMInput::AddTransitions(std::map<std::string, State*>& states, const std::
 std::string DTMInput::AlphabetFormatting(const Alphabet& ALPHABET) {
   return std::accumulate(ALPHABET.begin(), ALPHABET.end(), std::string{}, [](const std::string& ACCOUNT, const Symbol& SYMBOL) { return ACCOUNT + SYMBOL.ToString() + " "; });
 }
-
-/**
- * @brief Formats the states to a string.
- * 
- * @param STATES States to format.
- * @return The formatted states.
- */
-std::string DTMInput::StatesFormatting(const std::map<std::string, State*>& STATES) {
-  return std::accumulate(STATES.begin(), STATES.end(), std::string{}, [](const std::string& ACCOUNT, const std::pair<std::string, State*>& PAIR) { return ACCOUNT + PAIR.first + " "; });
-}
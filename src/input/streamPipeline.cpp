@@ -0,0 +1,255 @@
+/**
+ * @file streamPipeline.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to evaluate a stream of input strings through a parallel pipeline.
+ * @date 17/10/2026
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+#include "../../include/input/streamPipeline.hpp"
+
+/**
+ * @brief Number of bytes read from the stream at once, which is also the size of the output buffer.
+ */
+const std::size_t StreamPipeline::CHUNK_SIZE{1u << 20};
+
+/**
+ * @brief Number of chunks (and of chunks of results) that can wait between two stages of the pipeline.
+ */
+const std::size_t StreamPipeline::QUEUE_CAPACITY{4};
+
+/**
+ * @brief Maximum number of bytes of an input, which bounds the bytes carried from one chunk to the next.
+ */
+const std::size_t StreamPipeline::MAX_INPUT_LENGTH{64 * CHUNK_SIZE};
+
+/**
+ * @brief Returns the name of a verdict as written to the output.
+ */
+static const char* VerdictName(const HaltReason REASON) {
+  switch (REASON) {
+    case HaltReason::ACCEPTED:
+      return "accepted";
+    case HaltReason::REJECTED:
+      return "rejected";
+    case HaltReason::STEP_LIMIT:
+      return "step-limit";
+    case HaltReason::MEMORY_LIMIT:
+      return "memory-limit";
+    case HaltReason::LOOPING:
+      return "loops";
+    case HaltReason::DIVERGING:
+      return "diverges";
+  }
+  return "unknown";
+}
+
+/**
+ * @brief Constructs a new StreamPipeline object.
+ *
+ * @param givenDTM DTM that evaluates the inputs.
+ * @param LIMITS Budgets of each run.
+ * @param OPTIONS Options of the stream.
+ */
+StreamPipeline::StreamPipeline(DTM& givenDTM, const RunLimits& LIMITS, const StreamOptions& OPTIONS) : dtm{givenDTM}, limits{LIMITS}, options{OPTIONS} {}
+
+/**
+ * @brief Evaluates every input of a stream and writes the results to another one.
+ *
+ * @param input Stream of inputs.
+ * @param output Stream where the results are written.
+ * @throw std::invalid_argument If a length-prefixed input is malformed or truncated, or if an input is longer than
+ *        MAX_INPUT_LENGTH bytes. The results of the inputs before it are written.
+ */
+void StreamPipeline::Run(std::FILE* input, std::FILE* output) {
+  BoundedQueue<Chunk> chunks{QUEUE_CAPACITY};
+  BoundedQueue<Output> outputs{QUEUE_CAPACITY};
+  std::exception_ptr readError;
+  std::thread reader{[this, input, &chunks, &readError]() {
+    try {
+      Read(input, chunks);
+    } catch (...) {
+      readError = std::current_exception();
+    }
+    chunks.Close();
+  }};
+  std::thread writer{[this, output, &outputs]() { Write(output, outputs); }};
+  std::exception_ptr error;
+  try {
+    WorkStealingPool pool{options.threads};
+    Chunk chunk;
+    std::vector<std::string_view> views;
+    while (chunks.Pop(chunk)) {
+      views.clear();
+      for (const auto& [OFFSET, LENGTH] : chunk.inputs) {
+        views.emplace_back(chunk.data.data() + OFFSET, LENGTH);
+      }
+      Output results;
+      results.results = dtm.RunBatch(views, limits, pool, options.dumpTapes ? &results.tapes : nullptr, results.errors);
+      outputs.Push(std::move(results));
+    }
+  } catch (...) {
+    error = std::current_exception();
+  }
+  chunks.Close();
+  outputs.Close();
+  reader.join();
+  writer.join();
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  if (readError) {
+    std::rethrow_exception(readError);
+  }
+}
+
+/**
+ * @brief Reads the stream in chunks of whole inputs. While no input of a chunk is complete, the reads are appended to
+ *        it and scanned from where the last scan stopped; once some are, the chunk is pushed and only the bytes of the
+ *        unfinished input are copied to the next one, so every byte is scanned and copied once.
+ *
+ * @param input Stream of inputs.
+ * @param chunks Queue where the chunks are pushed.
+ * @throw std::invalid_argument If an input is malformed or too long. The chunk with the inputs before it is pushed
+ *        first.
+ */
+void StreamPipeline::Read(std::FILE* input, BoundedQueue<Chunk>& chunks) const {
+  Chunk chunk;
+  std::size_t scanned{0};
+  bool atEnd{false};
+  while (!atEnd) {
+    const std::size_t PREVIOUS{chunk.data.size()};
+    chunk.data.resize(PREVIOUS + CHUNK_SIZE);
+    const std::size_t READ{std::fread(&chunk.data[PREVIOUS], 1, CHUNK_SIZE, input)};
+    chunk.data.resize(PREVIOUS + READ);
+    atEnd = READ < CHUNK_SIZE;
+    std::size_t taken;
+    try {
+      taken = Split(chunk, atEnd, scanned);
+    } catch (const std::invalid_argument&) {
+      chunks.Push(std::move(chunk));
+      throw;
+    }
+    if (chunk.inputs.empty()) {
+      continue;
+    }
+    Chunk next;
+    next.data.assign(chunk.data, taken, std::string::npos);
+    scanned -= std::min(scanned, taken);
+    if (!chunks.Push(std::move(chunk))) {
+      return;
+    }
+    chunk = std::move(next);
+  }
+}
+
+/**
+ * @brief Formats the results of the chunks and writes them through a buffer of CHUNK_SIZE bytes. The errors of the
+ *        invalid inputs are written to the standard error as they are found.
+ *
+ * @param output Stream where the results are written.
+ * @param outputs Queue where the results are popped from.
+ */
+void StreamPipeline::Write(std::FILE* output, BoundedQueue<Output>& outputs) const {
+  std::string buffer;
+  buffer.reserve(2 * CHUNK_SIZE);
+  Output results;
+  std::uint64_t number{0};
+  while (outputs.Pop(results)) {
+    for (std::size_t i{0}; i < results.results.size(); ++i) {
+      ++number;
+      if (!results.errors[i].empty()) {
+        buffer += "invalid\t0\n";
+        std::fprintf(stderr, "Input %llu: %s\n", static_cast<unsigned long long>(number), results.errors[i].c_str());
+        continue;
+      }
+      buffer += VerdictName(results.results[i].reason);
+      buffer += '\t';
+      buffer += std::to_string(results.results[i].steps);
+      buffer += '\n';
+      if (options.dumpTapes) {
+        buffer += results.tapes[i];
+      }
+      if (buffer.size() >= CHUNK_SIZE) {
+        std::fwrite(buffer.data(), 1, buffer.size(), output);
+        buffer.clear();
+      }
+    }
+  }
+  std::fwrite(buffer.data(), 1, buffer.size(), output);
+  std::fflush(output);
+}
+
+/**
+ * @brief Finds the whole inputs of a chunk.
+ *
+ * @param chunk Chunk to split. Its inputs are filled.
+ * @param AT_END Whether the chunk ends the stream, so its last line needs no line feed.
+ * @param scanned Number of leading bytes of the chunk known to hold no line feed after its whole inputs. It is updated
+ *        to the bytes scanned by this call.
+ * @return The number of bytes of the chunk taken by whole inputs.
+ * @throw std::invalid_argument If a length-prefixed input is malformed or truncated, or if an input is longer than
+ *        MAX_INPUT_LENGTH bytes.
+ */
+std::size_t StreamPipeline::Split(Chunk& chunk, const bool AT_END, std::size_t& scanned) const {
+  const std::string& DATA{chunk.data};
+  std::size_t position{0};
+  if (options.format == StreamFormat::LINES) {
+    while (position < DATA.size()) {
+      std::size_t end{DATA.find('\n', std::max(position, scanned))};
+      if ((end == std::string::npos ? DATA.size() : end) - position > MAX_INPUT_LENGTH) {
+        throw std::invalid_argument{"Runtime error: Input longer than the maximum length in the input stream"};
+      }
+      if (end == std::string::npos && !AT_END) {
+        scanned = DATA.size();
+        break;
+      }
+      const std::size_t NEXT{end == std::string::npos ? DATA.size() : end + 1};
+      end = end == std::string::npos ? DATA.size() : end;
+      if (end > position && DATA[end - 1] == '\r') {
+        --end;
+      }
+      chunk.inputs.emplace_back(position, end - position);
+      position = NEXT;
+    }
+    return position;
+  }
+  while (true) {
+    std::size_t start{position};
+    while (start < DATA.size() && std::isspace(static_cast<unsigned char>(DATA[start]))) {
+      ++start;
+    }
+    if (start == DATA.size()) {
+      return start;
+    }
+    std::size_t colon{start};
+    std::size_t length{0};
+    while (colon < DATA.size() && colon - start < std::numeric_limits<std::size_t>::digits10 &&
+           std::isdigit(static_cast<unsigned char>(DATA[colon]))) {
+      length = length * 10 + static_cast<std::size_t>(DATA[colon] - '0');
+      ++colon;
+    }
+    if (colon == DATA.size() && !AT_END) {
+      return start;
+    }
+    if (colon == DATA.size() || colon == start || DATA[colon] != ':') {
+      throw std::invalid_argument{"Runtime error: Malformed length prefix in the input stream"};
+    }
+    if (length > MAX_INPUT_LENGTH) {
+      throw std::invalid_argument{"Runtime error: Input longer than the maximum length in the input stream"};
+    }
+    if (DATA.size() - colon - 1 < length) {
+      if (AT_END) {
+        throw std::invalid_argument{"Runtime error: Truncated input at the end of the input stream"};
+      }
+      return position;
+    }
+    chunk.inputs.emplace_back(colon + 1, length);
+    position = colon + 1 + length;
+  }
+}
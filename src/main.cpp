@@ -8,29 +8,171 @@
 #include <iostream>
 
 #include "../include/input/DTMInput.hpp"
+#include "../include/input/streamPipeline.hpp"
+
+/**
+ * @brief Usage message of the program.
+ */
+const std::string USAGE{" [--max-steps=<N>] [--max-memory=<BYTES>] [--detect-cycles] [--detect-divergence] [--engine=specialized|threaded|native|jit|runs|macro|hashlife|counters] [--block-size=<N>] [--cache-dir=<DIR>] [--stream] [--stream-format=lines|length-prefixed] [--dump-tapes] [--threads=<N>] <DTMFileName>"};
+
+/**
+ * @brief Parses the value of a numeric command line option.
+ *
+ * @param OPTION Option to parse, in the form '--name=value'.
+ * @param NAME Name of the option, including the leading dashes and the equal sign.
+ * @return The value of the option.
+ * @throw std::invalid_argument If the value is not a non-negative number.
+ */
+std::uint64_t ParseNumericOption(const std::string& OPTION, const std::string& NAME) {
+  const std::string VALUE{OPTION.substr(NAME.length())};
+  if (VALUE.empty() || VALUE.find_first_not_of("0123456789") != std::string::npos) {
+    throw std::invalid_argument{"Invalid value for option " + NAME + " '" + VALUE + "'"};
+  }
+  return std::stoull(VALUE);
+}
+
+/**
+ * @brief Parses the value of the engine command line option.
+ *
+ * @param OPTION Option to parse, in the form '--engine=name'.
+ * @return The engine selected.
+ * @throw std::invalid_argument If the engine does not exist.
+ */
+EngineKind ParseEngineOption(const std::string& OPTION) {
+  const std::string VALUE{OPTION.substr(std::string{"--engine="}.length())};
+  if (VALUE == "specialized") {
+    return EngineKind::SPECIALIZED;
+  }
+  if (VALUE == "threaded") {
+    return EngineKind::THREADED;
+  }
+  if (VALUE == "native") {
+    return EngineKind::NATIVE;
+  }
+  if (VALUE == "jit") {
+    return EngineKind::JIT;
+  }
+  if (VALUE == "runs") {
+    return EngineKind::RUN_LENGTH;
+  }
+  if (VALUE == "macro") {
+    return EngineKind::MACRO;
+  }
+  if (VALUE == "hashlife") {
+    return EngineKind::HASHLIFE;
+  }
+  if (VALUE == "counters") {
+    return EngineKind::COUNTERS;
+  }
+  throw std::invalid_argument{"Invalid value for option --engine= '" + VALUE + "'"};
+}
+
+/**
+ * @brief Parses the value of the stream format command line option.
+ *
+ * @param OPTION Option to parse, in the form '--stream-format=name'.
+ * @return The format selected.
+ * @throw std::invalid_argument If the format does not exist.
+ */
+StreamFormat ParseStreamFormatOption(const std::string& OPTION) {
+  const std::string VALUE{OPTION.substr(std::string{"--stream-format="}.length())};
+  if (VALUE == "lines") {
+    return StreamFormat::LINES;
+  }
+  if (VALUE == "length-prefixed") {
+    return StreamFormat::LENGTH_PREFIXED;
+  }
+  throw std::invalid_argument{"Invalid value for option --stream-format= '" + VALUE + "'"};
+}
 
 /**
  * @brief Main function which runs the program.
  * @return 0 on success, 1 on failure.
  */
 int main(const int ARGC, const char* ARGV[]) {
-  if (ARGC != 2) {
-    std::cerr << "Usage: " << ARGV[0] << " <DTMFileName>" << std::endl;
+  RunLimits limits;
+  EngineKind engine{EngineKind::SPECIALIZED};
+  std::string cacheDirectory{NativeEngine::DefaultCacheDirectory()};
+  unsigned blockSize{0};
+  std::string fileName;
+  bool stream{false};
+  StreamOptions streamOptions;
+  try {
+    for (int i{1}; i < ARGC; ++i) {
+      const std::string ARGUMENT{ARGV[i]};
+      if (ARGUMENT.rfind("--max-steps=", 0) == 0) {
+        limits.maxSteps = ParseNumericOption(ARGUMENT, "--max-steps=");
+      } else if (ARGUMENT.rfind("--max-memory=", 0) == 0) {
+        limits.maxMemory = ParseNumericOption(ARGUMENT, "--max-memory=");
+      } else if (ARGUMENT == "--detect-cycles") {
+        limits.detectCycles = true;
+      } else if (ARGUMENT == "--detect-divergence") {
+        limits.detectDivergence = true;
+      } else if (ARGUMENT.rfind("--engine=", 0) == 0) {
+        engine = ParseEngineOption(ARGUMENT);
+      } else if (ARGUMENT.rfind("--block-size=", 0) == 0) {
+        const std::uint64_t BLOCK_SIZE{ParseNumericOption(ARGUMENT, "--block-size=")};
+        if (BLOCK_SIZE == 0 || BLOCK_SIZE > 16) {
+          throw std::invalid_argument{"Invalid value for option --block-size= '" + std::to_string(BLOCK_SIZE) + "' (from 1 to 16)"};
+        }
+        blockSize = BLOCK_SIZE;
+      } else if (ARGUMENT.rfind("--cache-dir=", 0) == 0 && ARGUMENT.length() > std::string{"--cache-dir="}.length()) {
+        cacheDirectory = ARGUMENT.substr(std::string{"--cache-dir="}.length());
+      } else if (ARGUMENT == "--stream") {
+        stream = true;
+      } else if (ARGUMENT.rfind("--stream-format=", 0) == 0) {
+        streamOptions.format = ParseStreamFormatOption(ARGUMENT);
+      } else if (ARGUMENT == "--dump-tapes") {
+        streamOptions.dumpTapes = true;
+      } else if (ARGUMENT.rfind("--threads=", 0) == 0) {
+        streamOptions.threads = ParseNumericOption(ARGUMENT, "--threads=");
+      } else if (ARGUMENT.rfind("--", 0) == 0 || !fileName.empty()) {
+        throw std::invalid_argument{"Unknown argument '" + ARGUMENT + "'"};
+      } else {
+        fileName = ARGUMENT;
+      }
+    }
+    if (fileName.empty()) {
+      throw std::invalid_argument{"Missing DTM file name"};
+    }
+  } catch (const std::exception& EXCEPTION) {
+    std::cerr << EXCEPTION.what() << "\nUsage: " << ARGV[0] << USAGE << std::endl;
     return EXIT_FAILURE;
   }
-  const std::string FILE_NAME{ARGV[1]};
+  const std::string FILE_NAME{fileName};
   try {
     DTM dtm{DTMInput::ReadDTM(FILE_NAME)};
+    dtm.SetEngine(engine, cacheDirectory, blockSize);
+    if (stream) {
+      StreamPipeline{dtm, limits, streamOptions}.Run(stdin, stdout);
+      return EXIT_SUCCESS;
+    }
     std::cout << "DTM loaded from file " + FILE_NAME;
     std::string input;
     std::cout << "\nReading input strings from console (empty string to exit)...\n";
-    while (true) { 
+    while (true) {
       std::getline(std::cin, input);
       if (input.length() > 0) {
-        if (dtm.Accepts(input)) {
-          std::cout << "--> Accepted\n";
-        } else {
-          std::cout << "--> Rejected\n";
+        const RunResult RESULT{dtm.Run(input, limits)};
+        switch (RESULT.reason) {
+          case HaltReason::ACCEPTED:
+            std::cout << "--> Accepted\n";
+            break;
+          case HaltReason::REJECTED:
+            std::cout << "--> Rejected\n";
+            break;
+          case HaltReason::STEP_LIMIT:
+            std::cout << "--> Step limit reached after " << RESULT.steps << " steps\n";
+            break;
+          case HaltReason::MEMORY_LIMIT:
+            std::cout << "--> Memory limit reached after " << RESULT.steps << " steps\n";
+            break;
+          case HaltReason::LOOPING:
+            std::cout << "--> Loops forever (configuration repeated after " << RESULT.steps << " steps)\n";
+            break;
+          case HaltReason::DIVERGING:
+            std::cout << "--> Diverges (translated cycle into blank tape after " << RESULT.steps << " steps)\n";
+            break;
         }
         std::cout << dtm.TapesToString() << std::endl;
       } else {
@@ -38,7 +180,7 @@ int main(const int ARGC, const char* ARGV[]) {
       }
     }
   } catch (const std::exception& EXCEPTION) {
-    std::cout << EXCEPTION.what() << std::endl;
+    (stream ? std::cerr : std::cout) << EXCEPTION.what() << std::endl;
     return EXIT_FAILURE;
   }
 }
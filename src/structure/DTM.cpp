@@ -5,24 +5,23 @@
  * @date 19/10/2024
  */
 
+#include <stdexcept>
+
 #include "../../include/structure/DTM.hpp"
 
 /**
- * @brief Constructs a new DTM object.
+ * @brief Constructs a new DTM object. The states are compiled into the machine, so the arena can be discarded afterwards.
  * 
  * @param STATES Set of states of the DTM.
+ * @param TRANSITIONS Transitions of the DTM, already compressed.
  * @param ALPHABET Input alphabet of the DTM.
- * @param TAPE_ALPHABET Tape alphabet of the DTM.
- * @param givenInitialState Initial state of the DTM.
- * @param BLANK_SYMBOL Blank symbol of the DTM.
+ * @param SYMBOLS Symbol table of the tape alphabet of the DTM.
+ * @param INITIAL_STATE Id of the initial state of the DTM.
  * @param NUMBER_TAPES Number of tapes of the DTM.
+ * @param INPUT_SEPARATOR Separator of the symbols of the input strings, or an empty string if every character is a symbol.
  */
-DTM::DTM(const std::vector<State*>& STATES, const Alphabet& ALPHABET, const Alphabet& TAPE_ALPHABET, State* givenInitialState, const Symbol& BLANK_SYMBOL, const unsigned NUMBER_TAPES) : 
-         states{STATES}, alphabet{ALPHABET}, tapeAlphabet{TAPE_ALPHABET}, initialState{givenInitialState}, blankSymbol{BLANK_SYMBOL}, numberOfTapes{NUMBER_TAPES} {
-  for (unsigned i{0}; i < NUMBER_TAPES; ++i) {
-    tapes.emplace_back(Tape{BLANK_SYMBOL});
-  }
-}
+DTM::DTM(const StateArena& STATES, const TransitionTable& TRANSITIONS, const Alphabet& ALPHABET, const SymbolTable& SYMBOLS, const StateId INITIAL_STATE, const unsigned NUMBER_TAPES,
+         const std::string& INPUT_SEPARATOR) : machine{std::make_shared<const CompiledMachine>(STATES, TRANSITIONS, ALPHABET, SYMBOLS, INITIAL_STATE, NUMBER_TAPES, INPUT_SEPARATOR)}, workspace{machine->NewWorkspace()} {}
 
 /**
  * @brief Checks if the DTM accepts a given input string.
@@ -33,30 +32,127 @@ DTM::DTM(const std::vector<State*>& STATES, const Alphabet& ALPHABET, const Alph
  * @throw std::invalid_argument If the input string contains symbols not found in the alphabet.
  */
 bool DTM::Accepts(const std::string& INPUT) {
-  for (auto& TAPE : tapes) {
-    TAPE.Reset();
-  }
-  const std::vector<Symbol> INPUT_SYMBOLS{Symbol::ToSymbols(INPUT)};
-  for (const auto& SYMBOL : INPUT_SYMBOLS) {
-    if (alphabet.find(SYMBOL) == alphabet.end()) {
-      const std::string ALPHABET_STR{std::accumulate(alphabet.begin(), alphabet.end(), std::string{}, [](const std::string& ACCOUNT, const Symbol& SYMBOL) { return ACCOUNT + SYMBOL.ToString() + " "; })};
-      throw std::invalid_argument{"Runtime error: Input symbol: '" + SYMBOL.ToString() + "' not found in alphabet ( " + ALPHABET_STR + ")"};
-    }
-  }
-  tapes[0].InsertSymbols(INPUT_SYMBOLS);
-  State* currentState{initialState};
-  while (true) {
-    const std::vector<Symbol> READ_SYMBOLS{std::accumulate(tapes.begin(), tapes.end(), std::vector<Symbol>{}, [](std::vector<Symbol>& ACCOUNT, const Tape& TAPE) { ACCOUNT.emplace_back(TAPE.Read()); return ACCOUNT; })};
-    if (!currentState->Transitions().HasTransition(READ_SYMBOLS)) {
-      return currentState->IsFinal();
-    }
-    const TransitionResult& TRANSITION{currentState->Transitions().GetTransition(READ_SYMBOLS)};
-    for (unsigned i{0}; i < numberOfTapes; ++i) {
-      tapes[i].Write(std::get<0>(TRANSITION)[i]);
-      tapes[i].MoveHead(std::get<1>(TRANSITION)[i]);
-    }
-    currentState = std::get<2>(TRANSITION);
+  return Run(INPUT, RunLimits{}).reason == HaltReason::ACCEPTED;
+}
+
+/**
+ * @brief Runs the DTM on a given input string until it halts or exhausts one of the budgets (see CompiledMachine::Run).
+ * 
+ * @param INPUT Input string to run.
+ * @param LIMITS Budgets of the run.
+ * @return The result of the run.
+ * @throw std::invalid_argument If the input string contains symbols not found in the alphabet.
+ */
+RunResult DTM::Run(const std::string& INPUT, const RunLimits& LIMITS) {
+  return machine->Run(INPUT, LIMITS, workspace);
+}
+
+/**
+ * @brief Checks which strings of a batch the DTM accepts, running them in parallel (see RunBatch).
+ * 
+ * @param INPUTS Input strings to check.
+ * @param pool Pool of threads that runs the inputs.
+ * @return Whether the DTM accepts each input string, in the order of the inputs.
+ * @throw std::invalid_argument If an input string contains symbols not found in the alphabet.
+ */
+std::vector<bool> DTM::AcceptsBatch(const std::vector<std::string_view>& INPUTS, WorkStealingPool& pool) {
+  const std::vector<RunResult> RESULTS{RunBatch(INPUTS, RunLimits{}, pool)};
+  std::vector<bool> accepted(RESULTS.size());
+  for (std::size_t i{0}; i < RESULTS.size(); ++i) {
+    accepted[i] = RESULTS[i].reason == HaltReason::ACCEPTED;
   }
+  return accepted;
+}
+
+/**
+ * @brief Runs a batch of input strings in parallel on a pool of threads. Every worker of the pool has its own
+ *        workspace, kept between batches, and all of them share the compiled machine. Inputs are dealt longest first, as the
+ *        length of an input is the best guess of the length of its run available beforehand.
+ * 
+ * @param INPUTS Input strings to run.
+ * @param LIMITS Budgets of each run.
+ * @param pool Pool of threads that runs the inputs.
+ * @return The result of each run, in the order of the inputs.
+ * @throw std::invalid_argument If an input string contains symbols not found in the alphabet.
+ */
+std::vector<RunResult> DTM::RunBatch(const std::vector<std::string_view>& INPUTS, const RunLimits& LIMITS, WorkStealingPool& pool) {
+  return Evaluate(INPUTS, LIMITS, pool, nullptr, nullptr);
+}
+
+/**
+ * @brief Runs a batch of input strings in parallel on a pool of threads (see RunBatch), keeping the tapes left by
+ *        each run.
+ * 
+ * @param INPUTS Input strings to run.
+ * @param LIMITS Budgets of each run.
+ * @param pool Pool of threads that runs the inputs.
+ * @param tapes String representation of the tapes after each run, in the order of the inputs.
+ * @return The result of each run, in the order of the inputs.
+ * @throw std::invalid_argument If an input string contains symbols not found in the alphabet.
+ */
+std::vector<RunResult> DTM::RunBatch(const std::vector<std::string_view>& INPUTS, const RunLimits& LIMITS, WorkStealingPool& pool, std::vector<std::string>& tapes) {
+  return Evaluate(INPUTS, LIMITS, pool, &tapes, nullptr);
+}
+
+/**
+ * @brief Runs a batch of input strings in parallel on a pool of threads (see RunBatch), reporting the inputs with
+ *        symbols not found in the alphabet instead of throwing, so the rest of the batch is still run. The result of
+ *        such an input is a rejection after 0 steps, with no tapes.
+ *
+ * @param INPUTS Input strings to run.
+ * @param LIMITS Budgets of each run.
+ * @param pool Pool of threads that runs the inputs.
+ * @param tapes If not null, filled with the string representation of the tapes after each run.
+ * @param errors Message of the error of each input, or an empty string if it was run, in the order of the inputs.
+ * @return The result of each run, in the order of the inputs.
+ */
+std::vector<RunResult> DTM::RunBatch(const std::vector<std::string_view>& INPUTS, const RunLimits& LIMITS, WorkStealingPool& pool, std::vector<std::string>* tapes, std::vector<std::string>& errors) {
+  return Evaluate(INPUTS, LIMITS, pool, tapes, &errors);
+}
+
+/**
+ * @brief Selects the engine used to run the DTM. By default, the engine specialized on the number of tapes is used.
+ *        The native engine caches the compiled DTMs in NativeEngine::DefaultCacheDirectory().
+ * 
+ * @param KIND Engine to use.
+ * @throw std::runtime_error If the native engine cannot compile or load the DTM.
+ */
+void DTM::SetEngine(const EngineKind KIND) {
+  SetEngine(KIND, NativeEngine::DefaultCacheDirectory());
+}
+
+/**
+ * @brief Selects the engine used to run the DTM. The macro and Hashlife engines use blocks of MacroEngine::DefaultBlockSize
+ *        cells.
+ * 
+ * @param KIND Engine to use.
+ * @param CACHE_DIRECTORY Directory where the native engine caches the compiled DTMs.
+ * @throw std::runtime_error If the native engine cannot compile or load the DTM, or the JIT engine cannot map its code.
+ */
+void DTM::SetEngine(const EngineKind KIND, const std::string& CACHE_DIRECTORY) {
+  SetEngine(KIND, CACHE_DIRECTORY, 0);
+}
+
+/**
+ * @brief Selects the engine used to run the DTM. The machine shared before is not modified.
+ * 
+ * @param KIND Engine to use.
+ * @param CACHE_DIRECTORY Directory where the native engine caches the compiled DTMs.
+ * @param BLOCK_SIZE Number of cells of the blocks of the macro and Hashlife engines, or 0 to use the default size.
+ * @throw std::runtime_error If the native engine cannot compile or load the DTM, or the JIT engine cannot map its code.
+ * @throw std::invalid_argument If the blocks of the macro or Hashlife engines have too many distinct contents.
+ */
+void DTM::SetEngine(const EngineKind KIND, const std::string& CACHE_DIRECTORY, const unsigned BLOCK_SIZE) {
+  machine = machine->WithEngine(KIND, CACHE_DIRECTORY, BLOCK_SIZE);
+}
+
+/**
+ * @brief Returns the compiled machine of the DTM, to be shared with other threads.
+ * 
+ * @return The compiled machine.
+ */
+std::shared_ptr<const CompiledMachine> DTM::Machine() const {
+  return machine;
 }
 
 /**
@@ -65,18 +161,92 @@ bool DTM::Accepts(const std::string& INPUT) {
  * @return A string representation of the tapes of the DTM.
  */
 std::string DTM::TapesToString() const {
-  std::string result;
-  for (int i{0}; i < tapes.size(); ++i) {
-    result += "Tape " + std::to_string(tapes.size() - i) + ": " + tapes[tapes.size() - i - 1].ToString() + "\n";
+  return TapesToString(workspace.context);
+}
+
+/**
+ * @brief Runs a batch of input strings in parallel on a pool of threads (see RunBatch).
+ *
+ * @param INPUTS Input strings to run.
+ * @param LIMITS Budgets of each run.
+ * @param pool Pool of threads that runs the inputs.
+ * @param tapes If not null, filled with the string representation of the tapes after each run.
+ * @param errors If not null, filled with the message of the error of each input (empty if it was run) instead of
+ *        throwing it.
+ * @return The result of each run, in the order of the inputs.
+ * @throw std::invalid_argument If an input string contains symbols not found in the alphabet and errors is null.
+ */
+std::vector<RunResult> DTM::Evaluate(const std::vector<std::string_view>& INPUTS, const RunLimits& LIMITS, WorkStealingPool& pool, std::vector<std::string>* tapes, std::vector<std::string>* errors) {
+  const std::shared_ptr<const CompiledMachine> MACHINE{machine};
+  while (batchWorkspaces.size() < pool.Size()) {
+    batchWorkspaces.emplace_back(MACHINE->NewWorkspace());
+  }
+  std::vector<std::size_t> order(INPUTS.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&INPUTS](const std::size_t FIRST, const std::size_t SECOND) { return INPUTS[FIRST].size() > INPUTS[SECOND].size(); });
+  std::vector<RunResult> results(INPUTS.size());
+  if (tapes != nullptr) {
+    tapes->assign(INPUTS.size(), std::string{});
+  }
+  if (errors != nullptr) {
+    errors->assign(INPUTS.size(), std::string{});
+  }
+  pool.Run(order, [this, &MACHINE, &INPUTS, &LIMITS, &results, tapes, errors](const unsigned WORKER, const std::size_t INDEX) {
+    try {
+      results[INDEX] = MACHINE->Run(INPUTS[INDEX], LIMITS, batchWorkspaces[WORKER]);
+    } catch (const std::invalid_argument& EXCEPTION) {
+      if (errors == nullptr) {
+        throw;
+      }
+      results[INDEX] = RunResult{HaltReason::REJECTED, 0, {}};
+      (*errors)[INDEX] = EXCEPTION.what();
+      return;
+    }
+    if (tapes != nullptr) {
+      (*tapes)[INDEX] = TapesToString(batchWorkspaces[WORKER].context);
+    }
+  });
+  return results;
+}
+
+/**
+ * @brief Returns a string representation of the tapes of an execution context, whatever their layout.
+ * 
+ * @param CONTEXT Execution context of the last run.
+ * @return A string representation of the tapes.
+ */
+std::string DTM::TapesToString(const ExecutionContext& CONTEXT) const {
+  switch (CONTEXT.layout) {
+    case TapeLayout::RUN_LENGTH:
+      return TapesToString(CONTEXT.runTapes);
+    case TapeLayout::MACRO:
+      return TapesToString(CONTEXT.macroTapes);
+    case TapeLayout::SEGMENTS:
+      return TapesToString(CONTEXT.segmentTapes);
+    case TapeLayout::COUNTERS: {
+      std::string result;
+      for (int i{static_cast<int>(CONTEXT.tapes.size()) - 1}; i >= 0; --i) {
+        result += "Tape " + std::to_string(i + 1) + ": " + ((CONTEXT.counterMask >> i & 1) ? CONTEXT.counters[i].ToString(machine->Symbols()) : CONTEXT.tapes[i].ToString(machine->Symbols())) + "\n";
+      }
+      return result;
+    }
+    default:
+      return TapesToString(CONTEXT.tapes);
   }
-  return result;
 }
 
 /**
- * @brief Destroys the DTM object, freeing the memory of the states.
+ * @brief Returns a string representation of some tapes, the last one first.
+ * 
+ * @tparam T Type of the tapes: Tape, RunLengthTape, MacroTape or SegmentTape.
+ * @param TAPES Tapes to represent.
+ * @return A string representation of the tapes.
  */
-DTM::~DTM() {
-  for (const auto& STATE : states) {
-    delete STATE;
+template <typename T>
+std::string DTM::TapesToString(const std::vector<T>& TAPES) const {
+  std::string result;
+  for (std::size_t i{0}; i < TAPES.size(); ++i) {
+    result += "Tape " + std::to_string(TAPES.size() - i) + ": " + TAPES[TAPES.size() - i - 1].ToString(machine->Symbols()) + "\n";
   }
-}
\ No newline at end of file
+  return result;
+}
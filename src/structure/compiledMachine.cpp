@@ -0,0 +1,347 @@
+/**
+ * @file compiledMachine.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to represent a DTM compiled for execution.
+ * @date 17/10/2026
+ */
+
+#include <stdexcept>
+
+#include "../../include/structure/compiledMachine.hpp"
+
+/**
+ * @brief Number of steps between two checks of the budgets of a run.
+ */
+const std::uint64_t CompiledMachine::CHECK_INTERVAL{1u << 16};
+
+/**
+ * @brief Constructs a new CompiledMachine object, running on the engine specialized on its number of tapes. The
+ *        states are only read while compiling, so the arena can be discarded afterwards.
+ * 
+ * @param STATES Set of states of the DTM.
+ * @param TRANSITIONS Transitions of the DTM, already compressed.
+ * @param ALPHABET Input alphabet of the DTM.
+ * @param SYMBOLS Symbol table of the tape alphabet of the DTM.
+ * @param INITIAL_STATE Id of the initial state of the DTM.
+ * @param NUMBER_TAPES Number of tapes of the DTM.
+ * @param INPUT_SEPARATOR Separator of the symbols of the input strings, or an empty string if every character is a symbol.
+ * @throw std::invalid_argument If the transition function is too large.
+ */
+CompiledMachine::CompiledMachine(const StateArena& STATES, const TransitionTable& TRANSITIONS, const Alphabet& ALPHABET, const SymbolTable& SYMBOLS, const StateId INITIAL_STATE, const unsigned NUMBER_TAPES,
+                                 const std::string& INPUT_SEPARATOR) : symbols{SYMBOLS}, tokenizer{ALPHABET, symbols, INPUT_SEPARATOR}, numberOfTapes{NUMBER_TAPES}, dispatchTable{STATES, TRANSITIONS, symbols, NUMBER_TAPES},
+                                 initialStateIndex{INITIAL_STATE}, engine{SelectEngine(NUMBER_TAPES)},
+                                 cellBits{symbols.CellBits()}, layout{TapeLayout::FLAT}, blockSize{1}, counterMask{0} {}
+
+/**
+ * @brief Runs the machine on a given input string until it halts or exhausts one of the budgets. The budgets are checked
+ *        once every CHECK_INTERVAL steps, so the memory budget may be exceeded by the cells of that many steps. Engines on
+ *        compressed tapes get the whole remaining steps instead and return after CHECK_INTERVAL of their own operations,
+ *        which may cross any number of cells.
+ *        When cycle or divergence detection is enabled, the run is made step by step (see Monitor) instead of by the engine,
+ *        on flat tapes whatever the tapes of the engine.
+ * 
+ * The run only writes to the workspace, so any number of threads can run the same machine with their own workspaces.
+ * The run reuses the buffers of the execution context, so once warmed up the step loop does not allocate memory.
+ * 
+ * @param INPUT Input string to run.
+ * @param LIMITS Budgets of the run.
+ * @param workspace Workspace of the thread making the run.
+ * @return The result of the run.
+ * @throw std::invalid_argument If the input string contains symbols not found in the alphabet.
+ */
+RunResult CompiledMachine::Run(const std::string_view INPUT, const RunLimits& LIMITS, RunWorkspace& workspace) const {
+  ExecutionContext& context{workspace.context};
+  const bool MONITORED{LIMITS.detectCycles || LIMITS.detectDivergence};
+  Load(INPUT, MONITORED ? TapeLayout::FLAT : layout, context);
+  if (LIMITS.detectCycles) {
+    workspace.cycleDetector.Reset(context);
+  }
+  if (LIMITS.detectDivergence) {
+    workspace.sweepDetector.Reset(context);
+  }
+  while (true) {
+    const std::uint64_t MAX_STEPS{context.layout == TapeLayout::FLAT ? std::min(CHECK_INTERVAL, LIMITS.maxSteps - context.steps) : LIMITS.maxSteps - context.steps};
+    const bool RUNNING{MONITORED ? Monitor(LIMITS, MAX_STEPS, workspace) : engine(dispatchTable, context, MAX_STEPS)};
+    if (LIMITS.detectCycles && workspace.cycleDetector.Looping()) {
+      return Result(HaltReason::LOOPING, context);
+    }
+    if (LIMITS.detectDivergence && workspace.sweepDetector.Diverging()) {
+      return Result(HaltReason::DIVERGING, context);
+    }
+    if (!RUNNING || (context.steps == LIMITS.maxSteps && IsHalted(context))) {
+      return Result(dispatchTable.IsFinal(context.state) ? HaltReason::ACCEPTED : HaltReason::REJECTED, context);
+    }
+    if (context.steps == LIMITS.maxSteps) {
+      return Result(HaltReason::STEP_LIMIT, context);
+    }
+    if (MemoryUsage(context) > LIMITS.maxMemory) {
+      return Result(HaltReason::MEMORY_LIMIT, context);
+    }
+  }
+}
+
+/**
+ * @brief Returns a copy of the machine that runs on another engine. The JIT engine falls back to the specialized one
+ *        on platforms or DTMs it does not support. The native and JIT engines address whole cells, so their tapes use
+ *        a byte per cell (two for alphabets of more than 256 symbols) instead of packed cells. The run-length engine
+ *        runs on run-length tapes, the macro engine on a macro tape and the Hashlife engine on a segment tape; the last
+ *        two fall back to the specialized one on DTMs of several tapes. The counter engine keeps the tapes used as unary
+ *        counters as counters, and falls back to the specialized one on DTMs without them.
+ * 
+ * @param KIND Engine to use.
+ * @param CACHE_DIRECTORY Directory where the native engine caches the compiled DTMs.
+ * @param BLOCK_SIZE Number of cells of the blocks of the macro and Hashlife engines, or 0 to use MacroEngine::DefaultBlockSize.
+ * @return The machine running on the engine.
+ * @throw std::runtime_error If the native engine cannot compile or load the DTM, or the JIT engine cannot map its code.
+ * @throw std::invalid_argument If the blocks of the macro or Hashlife engines have too many distinct contents.
+ */
+std::shared_ptr<const CompiledMachine> CompiledMachine::WithEngine(const EngineKind KIND, const std::string& CACHE_DIRECTORY, const unsigned BLOCK_SIZE) const {
+  const std::shared_ptr<CompiledMachine> RESULT{std::make_shared<CompiledMachine>(*this)};
+  RESULT->cellBits = symbols.CellBits();
+  RESULT->layout = TapeLayout::FLAT;
+  switch (KIND) {
+    case EngineKind::SPECIALIZED:
+      RESULT->engine = SelectEngine(numberOfTapes);
+      break;
+    case EngineKind::THREADED: {
+      const std::shared_ptr<const ThreadedEngine> THREADED{std::make_shared<const ThreadedEngine>(dispatchTable)};
+      RESULT->engine = [THREADED](const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) { return THREADED->Run(TABLE, context, MAX_STEPS); };
+      break;
+    }
+    case EngineKind::NATIVE: {
+      RESULT->cellBits = std::max(symbols.CellBits(), 8u);
+      const std::shared_ptr<const NativeEngine> NATIVE{std::make_shared<const NativeEngine>(dispatchTable, numberOfTapes, RESULT->cellBits, CACHE_DIRECTORY)};
+      RESULT->engine = [NATIVE](const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) { return NATIVE->Run(TABLE, context, MAX_STEPS); };
+      break;
+    }
+    case EngineKind::JIT: {
+      if (!JitEngine::IsSupported(numberOfTapes, symbols.Size())) {
+        RESULT->engine = SelectEngine(numberOfTapes);
+        break;
+      }
+      const std::shared_ptr<const JitEngine> JIT{std::make_shared<const JitEngine>(dispatchTable, numberOfTapes, symbols.Size())};
+      RESULT->engine = [JIT](const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) { return JIT->Run(TABLE, context, MAX_STEPS); };
+      RESULT->cellBits = 8;
+      break;
+    }
+    case EngineKind::RUN_LENGTH: {
+      const std::shared_ptr<const RunLengthEngine> RUN_LENGTH{std::make_shared<const RunLengthEngine>(dispatchTable)};
+      RESULT->engine = [RUN_LENGTH](const DispatchTable& TABLE, ExecutionContext& context, const std::uint64_t MAX_STEPS) { return RUN_LENGTH->Run(TABLE, context, MAX_STEPS); };
+      RESULT->layout = TapeLayout::RUN_LENGTH;
+      break;
+    }
+    case EngineKind::MACRO:
+    case EngineKind::HASHLIFE: {
+      RESULT->blockSize = BLOCK_SIZE == 0 ? MacroEngine::DefaultBlockSize(symbols.Size()) : BLOCK_SIZE;
+      if (!MacroEngine::FitsBlocks(RESULT->blockSize, symbols.Size())) {
+        throw std::invalid_argument{"Block size " + std::to_string(RESULT->blockSize) + " too large for " + std::to_string(symbols.Size()) + " tape symbols (at most " + std::to_string(SymbolTable::MAX_SYMBOLS) + " distinct blocks)"};
+      }
+      if (numberOfTapes != 1) {
+        RESULT->engine = SelectEngine(numberOfTapes);
+        break;
+      }
+      RESULT->engine = KIND == EngineKind::MACRO ? MacroEngine::Run : HashlifeEngine::Run;
+      RESULT->layout = KIND == EngineKind::MACRO ? TapeLayout::MACRO : TapeLayout::SEGMENTS;
+      break;
+    }
+    case EngineKind::COUNTERS: {
+      RESULT->counterMask = CounterEngine::FindCounters(dispatchTable, numberOfTapes, initialStateIndex);
+      RESULT->engine = RESULT->counterMask == 0 ? SelectEngine(numberOfTapes) : CounterEngine::Run;
+      RESULT->layout = RESULT->counterMask == 0 ? TapeLayout::FLAT : TapeLayout::COUNTERS;
+      break;
+    }
+  }
+  return RESULT;
+}
+
+/**
+ * @brief Creates the workspace of a thread, with blank tapes.
+ * 
+ * @return A new workspace.
+ */
+RunWorkspace CompiledMachine::NewWorkspace() const {
+  RunWorkspace result{ExecutionContext{}, CycleDetector{}, SweepDetector{}};
+  for (unsigned i{0}; i < numberOfTapes; ++i) {
+    result.context.tapes.emplace_back(Tape{cellBits});
+    result.context.runTapes.emplace_back(RunLengthTape{});
+    result.context.counters.emplace_back(UnaryCounter{});
+  }
+  return result;
+}
+
+/**
+ * @brief Returns the symbol table of the tape alphabet, which decodes the cells of the tapes.
+ * 
+ * @return The symbol table.
+ */
+const SymbolTable& CompiledMachine::Symbols() const {
+  return symbols;
+}
+
+/**
+ * @brief Resets an execution context and writes an input string on its first tape. Tapes created by a machine running
+ *        on an engine with another cell width or block size are replaced, and so are the macro steps memoized on them.
+ *        Segment tapes are also replaced, with their segment steps, once they hold more than HashlifeEngine::MAX_NODES
+ *        segments.
+ * 
+ * @param INPUT Input string to load.
+ * @param LAYOUT Tapes to load.
+ * @param context Execution context to reset.
+ * @throw std::invalid_argument If the input string contains symbols not found in the alphabet.
+ */
+void CompiledMachine::Load(const std::string_view INPUT, const TapeLayout LAYOUT, ExecutionContext& context) const {
+  tokenizer.Tokenize(INPUT, context.input);
+  context.state = initialStateIndex;
+  context.steps = 0;
+  context.layout = LAYOUT;
+  if (LAYOUT == TapeLayout::RUN_LENGTH) {
+    context.runTapes[0].InsertSymbols(context.input);
+    std::for_each(context.runTapes.begin() + 1, context.runTapes.end(), [](RunLengthTape& tape) { tape.Reset(); });
+    return;
+  }
+  if (LAYOUT == TapeLayout::MACRO) {
+    if (context.macroTapes.empty() || context.macroTapes[0].BlockSize() != blockSize) {
+      context.macroTapes.assign(1, MacroTape{blockSize, symbols.Size()});
+      context.denseMacroSteps.assign(MacroEngine::DenseSteps(dispatchTable, context.macroTapes[0]), MacroStep{});
+      context.sparseMacroSteps.clear();
+    }
+    context.macroTapes[0].InsertSymbols(context.input);
+    return;
+  }
+  if (LAYOUT == TapeLayout::SEGMENTS) {
+    if (context.segmentTapes.empty() || context.segmentTapes[0].BlockSize() != blockSize || context.segmentTapes[0].NumberOfNodes() > HashlifeEngine::MAX_NODES) {
+      context.segmentTapes.assign(1, SegmentTape{blockSize, symbols.Size()});
+      context.segmentSteps.clear();
+    }
+    context.segmentTapes[0].InsertSymbols(context.input);
+    return;
+  }
+  for (auto& tape : context.tapes) {
+    if (tape.CellBits() != cellBits) {
+      tape = Tape{cellBits};
+    }
+    tape.Reset();
+  }
+  context.tapes[0].InsertSymbols(context.input);
+  context.counterMask = LAYOUT == TapeLayout::COUNTERS ? counterMask : 0;
+  std::for_each(context.counters.begin(), context.counters.end(), [](UnaryCounter& counter) { counter.Reset(); });
+}
+
+/**
+ * @brief Runs the machine one step at a time, feeding every step to the enabled detectors, until it halts, one of them
+ *        proves that it never halts or it makes MAX_STEPS steps.
+ * 
+ * @param LIMITS Budgets of the run, which select the detectors.
+ * @param MAX_STEPS Maximum number of steps to make.
+ * @param workspace Workspace of the thread making the run.
+ * @return true If the DTM made MAX_STEPS steps without halting.
+ * @return false If the DTM halted or never halts.
+ */
+bool CompiledMachine::Monitor(const RunLimits& LIMITS, const std::uint64_t MAX_STEPS, RunWorkspace& workspace) const {
+  ExecutionContext& context{workspace.context};
+  for (std::uint64_t steps{0}; steps < MAX_STEPS; ++steps) {
+    const unsigned SLOT{dispatchTable.Lookup(context.state, dispatchTable.Key(context.state, context.tapes))};
+    if (SLOT == DispatchTable::HALT) {
+      context.steps += steps;
+      return false;
+    }
+    const CompiledTransition& TRANSITION{dispatchTable.Transition(SLOT)};
+    if (LIMITS.detectCycles) {
+      workspace.cycleDetector.Update(TRANSITION, context);
+    }
+    for (unsigned i{0}; i < numberOfTapes; ++i) {
+      if (TRANSITION.writeSymbols[i] != SymbolTable::ANY) {
+        context.tapes[i].Write(TRANSITION.writeSymbols[i]);
+      }
+      context.tapes[i].MoveHead(TRANSITION.movements[i]);
+    }
+    context.state = TRANSITION.nextState;
+    if ((LIMITS.detectCycles && workspace.cycleDetector.Check(context)) || (LIMITS.detectDivergence && workspace.sweepDetector.Check(context))) {
+      context.steps += steps + 1;
+      return false;
+    }
+  }
+  context.steps += MAX_STEPS;
+  return true;
+}
+
+/**
+ * @brief Checks if the machine has no transition for the configuration of an execution context.
+ * 
+ * @param CONTEXT Execution context to check.
+ * @return true If the DTM halts in the current configuration.
+ * @return false If the DTM has a transition to apply.
+ */
+bool CompiledMachine::IsHalted(const ExecutionContext& CONTEXT) const {
+  switch (CONTEXT.layout) {
+    case TapeLayout::RUN_LENGTH:
+      return dispatchTable.Lookup(CONTEXT.state, dispatchTable.Key(CONTEXT.state, CONTEXT.runTapes)) == DispatchTable::HALT;
+    case TapeLayout::MACRO:
+      return dispatchTable.Lookup(CONTEXT.state, dispatchTable.Extend(0, (dispatchTable.ReadMask(CONTEXT.state) & 1) ? CONTEXT.macroTapes[0].Read() : 0)) == DispatchTable::HALT;
+    case TapeLayout::SEGMENTS:
+      return dispatchTable.Lookup(CONTEXT.state, dispatchTable.Extend(0, (dispatchTable.ReadMask(CONTEXT.state) & 1) ? CONTEXT.segmentTapes[0].Read() : 0)) == DispatchTable::HALT;
+    case TapeLayout::COUNTERS:
+      return dispatchTable.Lookup(CONTEXT.state, CounterEngine::Key(dispatchTable, CONTEXT.state, CONTEXT)) == DispatchTable::HALT;
+    default:
+      return dispatchTable.Lookup(CONTEXT.state, dispatchTable.Key(CONTEXT.state, CONTEXT.tapes)) == DispatchTable::HALT;
+  }
+}
+
+/**
+ * @brief Returns the memory used by the tapes of an execution context.
+ * 
+ * @param CONTEXT Execution context to measure.
+ * @return The memory used by the tapes in bytes.
+ */
+std::uint64_t CompiledMachine::MemoryUsage(const ExecutionContext& CONTEXT) const {
+  switch (CONTEXT.layout) {
+    case TapeLayout::RUN_LENGTH:
+      return std::accumulate(CONTEXT.runTapes.begin(), CONTEXT.runTapes.end(), std::uint64_t{0}, [](const std::uint64_t ACCOUNT, const RunLengthTape& TAPE) { return ACCOUNT + TAPE.MemoryUsage(); });
+    case TapeLayout::MACRO:
+      return CONTEXT.macroTapes[0].MemoryUsage();
+    case TapeLayout::SEGMENTS:
+      return CONTEXT.segmentTapes[0].MemoryUsage();
+    case TapeLayout::COUNTERS: {
+      std::uint64_t usage{0};
+      for (unsigned i{0}; i < numberOfTapes; ++i) {
+        usage += (CONTEXT.counterMask >> i & 1) ? CONTEXT.counters[i].MemoryUsage() : CONTEXT.tapes[i].MemoryUsage();
+      }
+      return usage;
+    }
+    default:
+      return std::accumulate(CONTEXT.tapes.begin(), CONTEXT.tapes.end(), std::uint64_t{0}, [](const std::uint64_t ACCOUNT, const Tape& TAPE) { return ACCOUNT + TAPE.MemoryUsage(); });
+  }
+}
+
+/**
+ * @brief Builds the result of the run of an execution context. Its tape extents are the only memory a warmed up run
+ *        allocates.
+ * 
+ * @param REASON Reason why the run ended.
+ * @param CONTEXT Execution context of the run.
+ * @return The result of the run.
+ */
+RunResult CompiledMachine::Result(const HaltReason REASON, const ExecutionContext& CONTEXT) const {
+  RunResult result{REASON, CONTEXT.steps, {}};
+  result.tapeExtents.reserve(numberOfTapes);
+  for (unsigned i{0}; i < numberOfTapes; ++i) {
+    switch (CONTEXT.layout) {
+      case TapeLayout::RUN_LENGTH:
+        result.tapeExtents.emplace_back(CONTEXT.runTapes[i].Extent());
+        break;
+      case TapeLayout::MACRO:
+        result.tapeExtents.emplace_back(CONTEXT.macroTapes[i].Extent());
+        break;
+      case TapeLayout::SEGMENTS:
+        result.tapeExtents.emplace_back(CONTEXT.segmentTapes[i].Extent());
+        break;
+      case TapeLayout::COUNTERS:
+        result.tapeExtents.emplace_back((CONTEXT.counterMask >> i & 1) ? CONTEXT.counters[i].Extent() : CONTEXT.tapes[i].Extent());
+        break;
+      default:
+        result.tapeExtents.emplace_back(CONTEXT.tapes[i].Extent());
+        break;
+    }
+  }
+  return result;
+}
@@ -0,0 +1,140 @@
+/**
+ * @file cycleDetector.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to detect DTM runs that repeat a configuration.
+ * @date 17/10/2026
+ */
+
+#include "../../include/structure/cycleDetector.hpp"
+
+/**
+ * @brief Constructs a new CycleDetector object.
+ */
+CycleDetector::CycleDetector() : hash{0}, power{1}, distance{0}, looping{false}, savedHash{0}, savedState{0} {}
+
+/**
+ * @brief Starts tracking a run whose input has just been loaded on the first tape of the execution context.
+ *
+ * @param CONTEXT Execution context of the run.
+ */
+void CycleDetector::Reset(const ExecutionContext& CONTEXT) {
+  hash = StateHash(CONTEXT.state);
+  for (unsigned i{0}; i < CONTEXT.tapes.size(); ++i) {
+    hash ^= HeadHash(i, CONTEXT.tapes[i].Position());
+  }
+  for (unsigned i{0}; i < CONTEXT.input.size(); ++i) {
+    hash ^= CellHash(0, i, CONTEXT.input[i]);
+  }
+  power = 1;
+  distance = 0;
+  looping = false;
+  Save(CONTEXT);
+}
+
+/**
+ * @brief Updates the hash of the configuration with the effects of a transition about to be applied.
+ *
+ * @param TRANSITION Transition to apply.
+ * @param CONTEXT Execution context of the run, before applying the transition.
+ */
+void CycleDetector::Update(const CompiledTransition& TRANSITION, const ExecutionContext& CONTEXT) {
+  hash ^= StateHash(CONTEXT.state) ^ StateHash(TRANSITION.nextState);
+  for (unsigned i{0}; i < CONTEXT.tapes.size(); ++i) {
+    const std::int64_t POSITION{CONTEXT.tapes[i].Position()};
+    const SymbolCode READ{TRANSITION.readSymbols[i] == SymbolTable::ANY ? CONTEXT.tapes[i].Read() : TRANSITION.readSymbols[i]};
+    if (TRANSITION.writeSymbols[i] != SymbolTable::ANY && TRANSITION.writeSymbols[i] != READ) {
+      hash ^= CellHash(i, POSITION, READ) ^ CellHash(i, POSITION, TRANSITION.writeSymbols[i]);
+    }
+    if (TRANSITION.movements[i] != Movement::STAY) {
+      hash ^= HeadHash(i, POSITION) ^ HeadHash(i, POSITION + (TRANSITION.movements[i] == Movement::RIGHT ? 1 : -1));
+    }
+  }
+}
+
+/**
+ * @brief Compares the configuration reached by a step against the saved one, and saves it if the distance to the
+ *        saved one reached the next power of two.
+ *
+ * @param CONTEXT Execution context of the run, after applying the transition passed to Update.
+ * @return true If the configuration was already reached, so the run loops forever.
+ * @return false Otherwise.
+ */
+bool CycleDetector::Check(const ExecutionContext& CONTEXT) {
+  if (hash == savedHash && Matches(CONTEXT)) {
+    looping = true;
+    return true;
+  }
+  if (++distance == power) {
+    Save(CONTEXT);
+    power *= 2;
+    distance = 0;
+  }
+  return false;
+}
+
+/**
+ * @brief Checks if the run being tracked repeated a configuration.
+ *
+ * @return true If the run loops forever.
+ * @return false Otherwise.
+ */
+bool CycleDetector::Looping() const {
+  return looping;
+}
+
+/**
+ * @brief Scrambles a 64-bit value (finalizer of SplitMix64).
+ */
+std::uint64_t CycleDetector::Mix(std::uint64_t value) {
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9u;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebu;
+  return value ^ (value >> 31);
+}
+
+/**
+ * @brief Returns the pseudo-random value of a state.
+ */
+std::uint64_t CycleDetector::StateHash(const unsigned STATE) {
+  return Mix(0x9e3779b97f4a7c15u * (STATE + 1));
+}
+
+/**
+ * @brief Returns the pseudo-random value of the head of a tape at a position.
+ */
+std::uint64_t CycleDetector::HeadHash(const unsigned TAPE, const std::int64_t POSITION) {
+  return Mix(Mix(0xc2b2ae3d27d4eb4fu * (TAPE + 1)) ^ static_cast<std::uint64_t>(POSITION));
+}
+
+/**
+ * @brief Returns the pseudo-random value of a symbol at a position of a tape, which is 0 for the blank symbol (code 0).
+ */
+std::uint64_t CycleDetector::CellHash(const unsigned TAPE, const std::int64_t POSITION, const SymbolCode SYMBOL) {
+  if (SYMBOL == 0) {
+    return 0;
+  }
+  return Mix(Mix(Mix(0x165667b19e3779f9u * (TAPE + 1)) ^ static_cast<std::uint64_t>(POSITION)) ^ SYMBOL);
+}
+
+/**
+ * @brief Saves the current configuration as the one the next steps are compared against.
+ */
+void CycleDetector::Save(const ExecutionContext& CONTEXT) {
+  savedHash = hash;
+  savedState = CONTEXT.state;
+  savedTapes = CONTEXT.tapes;
+}
+
+/**
+ * @brief Checks if the current configuration is the saved one.
+ */
+bool CycleDetector::Matches(const ExecutionContext& CONTEXT) const {
+  if (CONTEXT.state != savedState) {
+    return false;
+  }
+  for (unsigned i{0}; i < CONTEXT.tapes.size(); ++i) {
+    if (!(CONTEXT.tapes[i] == savedTapes[i])) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,619 @@
+/**
+ * @file dispatchTable.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to represent the compiled transition function of a DTM.
+ * @date 17/10/2026
+ */
+
+#include <limits>
+#include <stdexcept>
+
+#include "../../include/structure/dispatchTable.hpp"
+
+/**
+ * @brief Sentinel stored in the slots without a transition: the DTM halts.
+ */
+const unsigned DispatchTable::HALT{std::numeric_limits<unsigned>::max()};
+
+/**
+ * @brief Maximum number of slots of the dense table (64 MiB). Larger transition functions are stored sparsely.
+ */
+const std::uint64_t DispatchTable::MAX_DENSE_SLOTS{1u << 24};
+
+/**
+ * @brief Maximum number of transitions of a loop (see TransitionLoop).
+ */
+const unsigned DispatchTable::MAX_LOOP_PERIOD{8};
+
+/**
+ * @brief Maximum number of transitions tried when looking for the loop that starts at a transition.
+ */
+const unsigned DispatchTable::MAX_LOOP_SEARCH{256};
+
+/**
+ * @brief Compiles the transitions of the given states into a dispatch table. The index of each state is its id.
+ *        Wildcard reads (SymbolTable::ANY) on the tapes a state reads are expanded into one transition per symbol, and
+ *        keep writes (also SymbolTable::ANY) on those tapes become writes of the symbol read. When several transitions
+ *        match the same symbols, the one with fewer expanded wildcards wins, and then the one added first. The
+ *        transitions with wildcards are also kept unexpanded, in that order (see WildcardRow). Then the scans and the
+ *        loops that start at every transition are found.
+ *
+ * @param STATES States of the DTM.
+ * @param TRANSITIONS Transitions of the DTM, already compressed.
+ * @param SYMBOLS Symbol table of the tape alphabet of the DTM.
+ * @param NUMBER_OF_TAPES Number of tapes of the DTM.
+ * @throw std::invalid_argument If the keys of the transition function do not fit in 64 bits or the wildcards expand
+ *        to more than MAX_DENSE_SLOTS transitions.
+ */
+DispatchTable::DispatchTable(const StateArena& STATES, const TransitionTable& TRANSITIONS, const SymbolTable& SYMBOLS, const unsigned NUMBER_OF_TAPES) :
+                             keySpace{1}, readsAllTapes{true}, radix{SYMBOLS.Size()} {
+  for (unsigned i{0}; i < NUMBER_OF_TAPES; ++i) {
+    if (i == 64 || keySpace > std::numeric_limits<std::uint64_t>::max() / radix / std::max<std::uint64_t>(STATES.Size(), 1)) {
+      throw std::invalid_argument{"Reading file error: Transition function too large (" + std::to_string(NUMBER_OF_TAPES) + " tapes of " + std::to_string(radix) + " symbols)"};
+    }
+    keySpace *= radix;
+  }
+  for (StateId i{0}; i < STATES.Size(); ++i) {
+    finalStates.emplace_back(STATES.At(i).IsFinal());
+    std::uint64_t mask{0};
+    for (unsigned j{TRANSITIONS.Begin(i)}; j < TRANSITIONS.End(i); ++j) {
+      for (unsigned k{0}; k < NUMBER_OF_TAPES; ++k) {
+        mask |= std::uint64_t{TRANSITIONS.ReadSymbols(j)[k] != SymbolTable::ANY} << k;
+      }
+    }
+    readMasks.emplace_back(mask);
+    if (TRANSITIONS.Begin(i) < TRANSITIONS.End(i) && mask != (std::uint64_t{1} << NUMBER_OF_TAPES) - 1) {
+      readsAllTapes = false;
+    }
+  }
+  const bool IS_DENSE{keySpace * STATES.Size() <= MAX_DENSE_SLOTS};
+  if (IS_DENSE) {
+    denseSlots.resize(keySpace * STATES.Size(), HALT);
+  }
+  std::uint64_t expanded{0};
+  for (StateId i{0}; i < STATES.Size(); ++i) {
+    wildcardRowOffsets.emplace_back(wildcardRows.size());
+    std::vector<std::pair<unsigned, unsigned>> byWildcards;
+    for (unsigned j{TRANSITIONS.Begin(i)}; j < TRANSITIONS.End(i); ++j) {
+      unsigned wildcards{0};
+      for (unsigned k{0}; k < NUMBER_OF_TAPES; ++k) {
+        wildcards += (readMasks[i] >> k & 1) && TRANSITIONS.ReadSymbols(j)[k] == SymbolTable::ANY;
+      }
+      byWildcards.emplace_back(wildcards, j);
+    }
+    std::stable_sort(byWildcards.begin(), byWildcards.end(), [](const auto& FIRST, const auto& SECOND) { return FIRST.first < SECOND.first; });
+    for (const auto& [WILDCARDS, J] : byWildcards) {
+      std::uint64_t combinations{1};
+      for (unsigned k{0}; k < WILDCARDS; ++k) {
+        combinations = std::min(combinations * radix, MAX_DENSE_SLOTS + 1);
+      }
+      expanded += WILDCARDS > 0 ? combinations : 0;
+      if (expanded > MAX_DENSE_SLOTS) {
+        throw std::invalid_argument{"Reading file error: Transition function too large (wildcards expand to more than " + std::to_string(MAX_DENSE_SLOTS) + " transitions)"};
+      }
+      Expand(i, TRANSITIONS, J, NUMBER_OF_TAPES, IS_DENSE);
+      if (WILDCARDS > 0) {
+        wildcardRows.emplace_back(CompiledTransition{{TRANSITIONS.ReadSymbols(J), TRANSITIONS.ReadSymbols(J) + NUMBER_OF_TAPES},
+                                                     {TRANSITIONS.WriteSymbols(J), TRANSITIONS.WriteSymbols(J) + NUMBER_OF_TAPES},
+                                                     {TRANSITIONS.Movements(J), TRANSITIONS.Movements(J) + NUMBER_OF_TAPES}, TRANSITIONS.NextState(J), i});
+      }
+    }
+  }
+  wildcardRowOffsets.emplace_back(wildcardRows.size());
+  for (unsigned slot{0}; slot < transitions.size(); ++slot) {
+    CompiledTransition& transition{transitions[slot]};
+    const int SCAN_TAPE{ScanTape(transition.fromState, transition)};
+    if (SCAN_TAPE == -1) {
+      continue;
+    }
+    transition.scanTape = SCAN_TAPE;
+    if ((readMasks[transition.fromState] >> SCAN_TAPE & 1) == 0) {
+      for (unsigned i{0}; i < radix; ++i) {
+        transition.scanSymbols.emplace_back(i);
+      }
+      continue;
+    }
+    std::uint64_t weight{1};
+    for (unsigned i{SCAN_TAPE + 1u}; i < NUMBER_OF_TAPES; ++i) {
+      weight *= radix;
+    }
+    const std::uint64_t BASE_KEY{Key(transition.readSymbols) - transition.readSymbols[SCAN_TAPE] * weight};
+    for (unsigned i{0}; i < radix; ++i) {
+      const unsigned OTHER_SLOT{Lookup(transition.fromState, BASE_KEY + i * weight)};
+      if (OTHER_SLOT != HALT && ScanTape(transition.fromState, transitions[OTHER_SLOT]) == SCAN_TAPE &&
+          transitions[OTHER_SLOT].movements[SCAN_TAPE] == transition.movements[SCAN_TAPE]) {
+        transition.scanSymbols.emplace_back(i);
+      }
+    }
+  }
+  std::vector<std::vector<unsigned>> slotsOf(STATES.Size());
+  for (unsigned slot{0}; slot < transitions.size(); ++slot) {
+    slotsOf[transitions[slot].fromState].emplace_back(slot);
+  }
+  std::uint64_t searched{0};
+  for (unsigned slot{0}; slot < transitions.size() && searched < MAX_DENSE_SLOTS; ++slot) {
+    const CompiledTransition& TRANSITION{transitions[slot]};
+    const bool MOVES{std::any_of(TRANSITION.movements.begin(), TRANSITION.movements.end(), [](const Movement& MOVEMENT) { return MOVEMENT != Movement::STAY; })};
+    if (TRANSITION.scanTape != -1 || !MOVES || !Continues(TRANSITION, TRANSITION)) {
+      continue;
+    }
+    std::vector<unsigned> cycle{slot};
+    unsigned budget{MAX_LOOP_SEARCH};
+    if (FollowLoop(cycle, slotsOf, budget)) {
+      AddLoop(cycle);
+    }
+    searched += MAX_LOOP_SEARCH - budget;
+  }
+  PackActions(NUMBER_OF_TAPES);
+}
+
+/**
+ * @brief Adds the transitions a transition of a state expands to: one per combination of the symbols of its wildcard
+ *        reads on the tapes the state reads. Keys already taken by previous transitions are kept.
+ *
+ * @param STATE Id of the state.
+ * @param TRANSITIONS Transitions of the DTM.
+ * @param INDEX Index of the transition in TRANSITIONS.
+ * @param NUMBER_OF_TAPES Number of tapes of the DTM.
+ * @param IS_DENSE Whether the slots are dense.
+ */
+void DispatchTable::Expand(const StateId STATE, const TransitionTable& TRANSITIONS, const unsigned INDEX, const unsigned NUMBER_OF_TAPES, const bool IS_DENSE) {
+  std::vector<SymbolCode> readCodes{TRANSITIONS.ReadSymbols(INDEX), TRANSITIONS.ReadSymbols(INDEX) + NUMBER_OF_TAPES};
+  std::vector<unsigned> wildcards;
+  for (unsigned k{0}; k < NUMBER_OF_TAPES; ++k) {
+    if ((readMasks[STATE] >> k & 1) && readCodes[k] == SymbolTable::ANY) {
+      wildcards.emplace_back(k);
+      readCodes[k] = 0;
+    }
+  }
+  while (true) {
+    const std::uint64_t SLOT_KEY{STATE * keySpace + Key(readCodes)};
+    unsigned& slot{IS_DENSE ? denseSlots[SLOT_KEY] : sparseSlots.emplace(SLOT_KEY, HALT).first->second};
+    if (slot == HALT) {
+      std::vector<SymbolCode> writeCodes{TRANSITIONS.WriteSymbols(INDEX), TRANSITIONS.WriteSymbols(INDEX) + NUMBER_OF_TAPES};
+      for (unsigned k{0}; k < NUMBER_OF_TAPES; ++k) {
+        if (writeCodes[k] == SymbolTable::ANY) {
+          writeCodes[k] = readCodes[k];
+        }
+      }
+      slot = transitions.size();
+      transitions.emplace_back(CompiledTransition{readCodes, writeCodes, {TRANSITIONS.Movements(INDEX), TRANSITIONS.Movements(INDEX) + NUMBER_OF_TAPES}, TRANSITIONS.NextState(INDEX), STATE});
+      transitions.back().expanded = !wildcards.empty();
+    }
+    unsigned k{0};
+    while (k < wildcards.size() && ++readCodes[wildcards[k]] == radix) {
+      readCodes[wildcards[k++]] = 0;
+    }
+    if (k == wildcards.size()) {
+      return;
+    }
+  }
+}
+
+/**
+ * @brief Packs the symbols under the heads of the tapes a state reads into a key. The other tapes count as reading
+ *        the symbol with code 0.
+ *
+ * @param STATE Index of the current state.
+ * @param TAPES Tapes to read.
+ * @return The packed key of the read symbols.
+ */
+std::uint64_t DispatchTable::Key(const unsigned STATE, const std::vector<Tape>& TAPES) const {
+  const std::uint64_t MASK{readMasks[STATE]};
+  std::uint64_t key{0};
+  for (unsigned i{0}; i < TAPES.size(); ++i) {
+    key = Extend(key, (MASK >> i & 1) ? TAPES[i].Read() : 0);
+  }
+  return key;
+}
+
+/**
+ * @brief Packs the symbols under the heads of the run-length tapes a state reads into a key (see Key).
+ *
+ * @param STATE Index of the current state.
+ * @param TAPES Tapes to read.
+ * @return The packed key of the read symbols.
+ */
+std::uint64_t DispatchTable::Key(const unsigned STATE, const std::vector<RunLengthTape>& TAPES) const {
+  const std::uint64_t MASK{readMasks[STATE]};
+  std::uint64_t key{0};
+  for (unsigned i{0}; i < TAPES.size(); ++i) {
+    key = Extend(key, (MASK >> i & 1) ? TAPES[i].Read() : 0);
+  }
+  return key;
+}
+
+/**
+ * @brief Packs a tuple of read symbols into a key. Wildcards (SymbolTable::ANY) count as the symbol with code 0.
+ *
+ * @param READ_SYMBOLS Codes of the symbols to pack, one per tape.
+ * @return The packed key of the symbols.
+ */
+std::uint64_t DispatchTable::Key(const std::vector<SymbolCode>& READ_SYMBOLS) const {
+  std::uint64_t key{0};
+  for (const auto& SYMBOL : READ_SYMBOLS) {
+    key = Extend(key, SYMBOL == SymbolTable::ANY ? 0 : SYMBOL);
+  }
+  return key;
+}
+
+/**
+ * @brief Returns the tapes a state reads: those some transition of the state does not read with a wildcard. The
+ *        symbols on the other tapes do not select its transitions, so engines may skip reading them.
+ *
+ * @param STATE Index of the state.
+ * @return A mask with the bit of each tape read set.
+ */
+std::uint64_t DispatchTable::ReadMask(const unsigned STATE) const {
+  return readMasks[STATE];
+}
+
+/**
+ * @brief Returns whether every state with transitions reads all the tapes, so keys can be built without the read masks.
+ *
+ * @return true If no state leaves a tape unread.
+ * @return false If some state does.
+ */
+bool DispatchTable::ReadsAllTapes() const {
+  return readsAllTapes;
+}
+
+/**
+ * @brief Appends the symbol read from one more tape to a partial key.
+ *
+ * @param KEY Key of the symbols read from the previous tapes.
+ * @param SYMBOL Code of the symbol read from the next tape.
+ * @return The extended key.
+ */
+std::uint64_t DispatchTable::Extend(const std::uint64_t KEY, const SymbolCode SYMBOL) const {
+  return KEY * radix + SYMBOL;
+}
+
+/**
+ * @brief Returns the slot of the transition of a state for a given key.
+ *
+ * @param STATE Index of the current state.
+ * @param KEY Packed key of the read symbols.
+ * @return The slot of the transition or HALT if there is no transition.
+ */
+unsigned DispatchTable::Lookup(const unsigned STATE, const std::uint64_t KEY) const {
+  if (!denseSlots.empty()) {
+    return denseSlots[STATE * keySpace + KEY];
+  }
+  const auto SLOT{sparseSlots.find(STATE * keySpace + KEY)};
+  return SLOT == sparseSlots.end() ? HALT : SLOT->second;
+}
+
+/**
+ * @brief Returns the transition stored in a slot.
+ *
+ * @param SLOT Slot of the transition, as returned by Lookup.
+ * @return The compiled transition.
+ */
+const CompiledTransition& DispatchTable::Transition(const unsigned SLOT) const {
+  return transitions[SLOT];
+}
+
+/**
+ * @brief Returns a loop of transitions.
+ *
+ * @param LOOP Index of the loop, as stored in the transition that starts it.
+ * @return The loop.
+ */
+const TransitionLoop& DispatchTable::Loop(const unsigned LOOP) const {
+  return loops[LOOP];
+}
+
+/**
+ * @brief Returns the number of loops found.
+ *
+ * @return The number of transitions that start a loop.
+ */
+unsigned DispatchTable::NumberOfLoops() const {
+  return loops.size();
+}
+
+/**
+ * @brief Returns the number of compiled transitions. Their slots go from 0 to this number minus one.
+ *
+ * @return The number of transitions.
+ */
+unsigned DispatchTable::NumberOfTransitions() const {
+  return transitions.size();
+}
+
+/**
+ * @brief Returns the index of the first wildcard row of a state. Its rows go from this index to WildcardRowsEnd.
+ *
+ * @param STATE Index of the state.
+ * @return The index of the first row of the state.
+ */
+unsigned DispatchTable::WildcardRowsBegin(const unsigned STATE) const {
+  return wildcardRowOffsets[STATE];
+}
+
+/**
+ * @brief Returns the index past the last wildcard row of a state.
+ *
+ * @param STATE Index of the state.
+ * @return The index past the last row of the state.
+ */
+unsigned DispatchTable::WildcardRowsEnd(const unsigned STATE) const {
+  return wildcardRowOffsets[STATE + 1];
+}
+
+/**
+ * @brief Returns a transition with wildcard reads on the tapes its state reads, unexpanded: it reads and writes
+ *        SymbolTable::ANY where the DTM does. It applies to the symbols no transition without wildcards of its state
+ *        reads and no earlier row of its state matches; its expanded transitions are the slots it won.
+ *
+ * @param ROW Index of the row.
+ * @return The wildcard row.
+ */
+const CompiledTransition& DispatchTable::WildcardRow(const unsigned ROW) const {
+  return wildcardRows[ROW];
+}
+
+/**
+ * @brief Returns the number of states. Their indexes go from 0 to this number minus one.
+ *
+ * @return The number of states.
+ */
+unsigned DispatchTable::NumberOfStates() const {
+  return finalStates.size();
+}
+
+/**
+ * @brief Checks if a state is final.
+ *
+ * @param STATE Index of the state.
+ * @return true If the state is final.
+ * @return false If the state is not final.
+ */
+bool DispatchTable::IsFinal(const unsigned STATE) const {
+  return finalStates[STATE];
+}
+
+/**
+ * @brief Checks if a transition is a scan: it loops on its state, writes the symbols it reads and moves a single tape.
+ *
+ * @param FROM_STATE Index of the state the transition belongs to.
+ * @param TRANSITION Transition to check.
+ * @return The index of the tape moved by the scan, or -1 if the transition is not a scan.
+ */
+int DispatchTable::ScanTape(const unsigned FROM_STATE, const CompiledTransition& TRANSITION) {
+  if (TRANSITION.nextState != FROM_STATE || TRANSITION.writeSymbols != TRANSITION.readSymbols) {
+    return -1;
+  }
+  int scanTape{-1};
+  for (unsigned i{0}; i < TRANSITION.movements.size(); ++i) {
+    if (TRANSITION.movements[i] == Movement::STAY) {
+      continue;
+    }
+    if (scanTape != -1) {
+      return -1;
+    }
+    scanTape = i;
+  }
+  return scanTape;
+}
+
+/**
+ * @brief Checks if a transition can follow the first one of a loop: it makes the same movements, and on the tapes
+ *        that stay it reads nothing or the symbol the first one reads, and writes nothing or the symbol it reads, so
+ *        those cells never change.
+ *
+ * @param FIRST First transition of the loop.
+ * @param TRANSITION Transition to check.
+ * @return true If the transition can be part of the loop.
+ * @return false Otherwise.
+ */
+bool DispatchTable::Continues(const CompiledTransition& FIRST, const CompiledTransition& TRANSITION) {
+  if (TRANSITION.movements != FIRST.movements) {
+    return false;
+  }
+  for (unsigned i{0}; i < FIRST.movements.size(); ++i) {
+    if (FIRST.movements[i] != Movement::STAY) {
+      continue;
+    }
+    const SymbolCode READ{TRANSITION.readSymbols[i]};
+    if ((READ != SymbolTable::ANY && READ != FIRST.readSymbols[i]) || TRANSITION.writeSymbols[i] != READ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Extends a sequence of transitions, depth first, until the state it leads to is the state of its first
+ *        transition, so the sequence repeats as a loop.
+ *
+ * @param cycle Slots of the transitions of the sequence, extended with the ones of the loop if one is found.
+ * @param SLOTS_OF Slots of the transitions of every state.
+ * @param budget Number of transitions that can still be tried. It is decreased by every one tried.
+ * @return true If a loop of at most MAX_LOOP_PERIOD transitions was found.
+ * @return false Otherwise.
+ */
+bool DispatchTable::FollowLoop(std::vector<unsigned>& cycle, const std::vector<std::vector<unsigned>>& SLOTS_OF, unsigned& budget) const {
+  const CompiledTransition& FIRST{transitions[cycle.front()]};
+  const StateId NEXT_STATE{transitions[cycle.back()].nextState};
+  if (NEXT_STATE == FIRST.fromState) {
+    return true;
+  }
+  if (cycle.size() == MAX_LOOP_PERIOD || NEXT_STATE >= SLOTS_OF.size()) {
+    return false;
+  }
+  for (const unsigned SLOT : SLOTS_OF[NEXT_STATE]) {
+    if (budget == 0) {
+      return false;
+    }
+    --budget;
+    if (Continues(FIRST, transitions[SLOT])) {
+      cycle.emplace_back(SLOT);
+      if (FollowLoop(cycle, SLOTS_OF, budget)) {
+        return true;
+      }
+      cycle.pop_back();
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Stores the loop made by a cycle of transitions and marks its first transition as its start. Writes of the
+ *        symbol read are stored as kept cells, so they are skipped when the loop is applied.
+ *
+ * @param CYCLE Slots of the transitions of the loop, in order.
+ */
+void DispatchTable::AddLoop(const std::vector<unsigned>& CYCLE) {
+  CompiledTransition& first{transitions[CYCLE.front()]};
+  TransitionLoop loop{{}, first.movements, std::vector<std::vector<SymbolCode>>(first.movements.size()), std::vector<std::vector<SymbolCode>>(first.movements.size())};
+  for (const unsigned SLOT : CYCLE) {
+    const CompiledTransition& TRANSITION{transitions[SLOT]};
+    loop.states.emplace_back(TRANSITION.fromState);
+    for (unsigned i{0}; i < TRANSITION.movements.size(); ++i) {
+      if (TRANSITION.movements[i] != Movement::STAY) {
+        loop.readSymbols[i].emplace_back(TRANSITION.readSymbols[i]);
+        loop.writeSymbols[i].emplace_back(TRANSITION.writeSymbols[i] == TRANSITION.readSymbols[i] ? SymbolTable::ANY : TRANSITION.writeSymbols[i]);
+      }
+    }
+  }
+  first.loop = static_cast<int>(loops.size());
+  loops.emplace_back(std::move(loop));
+}
+
+/**
+ * @brief Checks if the actions of the transitions are packed (see PackActions).
+ *
+ * @return true If Action can be called.
+ * @return false If the actions do not fit in a word, so only the compiled transitions are available.
+ */
+bool DispatchTable::HasPackedActions() const {
+  return !actions.empty();
+}
+
+/**
+ * @brief Returns the packed action of the transition stored in a slot.
+ *
+ * @param SLOT Slot of the transition, as returned by Lookup.
+ * @return The packed action, decoded by WriteSymbol, MovementOf, NextState and IsSummarized.
+ */
+std::uint64_t DispatchTable::Action(const unsigned SLOT) const {
+  return actions[slotActions[SLOT]];
+}
+
+/**
+ * @brief Returns the number of distinct packed actions.
+ *
+ * @return The number of actions, at most the number of transitions.
+ */
+unsigned DispatchTable::NumberOfActions() const {
+  return actions.size();
+}
+
+/**
+ * @brief Decodes the code written on a tape by a packed action.
+ *
+ * @param ACTION Packed action.
+ * @param TAPE Index of the tape.
+ * @return The code of the symbol to write.
+ */
+SymbolCode DispatchTable::WriteSymbol(const std::uint64_t ACTION, const unsigned TAPE) const {
+  return (ACTION >> (1 + TAPE * fieldBits)) & symbolMask;
+}
+
+/**
+ * @brief Checks if a packed action changes the symbol under the head of a tape. Tapes it rewrites with the symbol
+ *        they hold, or that it keeps, need no write.
+ *
+ * @param ACTION Packed action.
+ * @param TAPE Index of the tape.
+ * @return true If WriteSymbol must be written on the tape.
+ * @return false If the tape is left untouched.
+ */
+bool DispatchTable::Writes(const std::uint64_t ACTION, const unsigned TAPE) const {
+  return ACTION >> (TAPE * fieldBits + fieldBits) & 1;
+}
+
+/**
+ * @brief Decodes the movement of a tape made by a packed action.
+ *
+ * @param ACTION Packed action.
+ * @param TAPE Index of the tape.
+ * @return The movement to make.
+ */
+Movement DispatchTable::MovementOf(const std::uint64_t ACTION, const unsigned TAPE) const {
+  static const Movement MOVEMENTS[4]{Movement::STAY, Movement::LEFT, Movement::RIGHT, Movement::STAY};
+  return MOVEMENTS[(ACTION >> (1 + TAPE * fieldBits + fieldBits - 3)) & 3];
+}
+
+/**
+ * @brief Decodes the next state of a packed action.
+ *
+ * @param ACTION Packed action.
+ * @return The index of the next state.
+ */
+StateId DispatchTable::NextState(const std::uint64_t ACTION) const {
+  return ACTION >> stateShift;
+}
+
+/**
+ * @brief Checks if a packed action belongs to a scan or to the start of a loop. The flag is packed into the action
+ *        before it is interned, so it is set only on those transitions, and only then must Transition be read to get
+ *        their scan symbols or their loop.
+ *
+ * @param ACTION Packed action.
+ * @return true If the transition of the action is a scan or starts a loop.
+ * @return false Otherwise.
+ */
+bool DispatchTable::IsSummarized(const std::uint64_t ACTION) {
+  return ACTION & 1;
+}
+
+/**
+ * @brief Returns the number of bits needed to hold the values from 0 to COUNT - 1 (at least 1).
+ *
+ * @param COUNT Number of values.
+ * @return The number of bits.
+ */
+unsigned DispatchTable::BitsFor(const std::uint64_t COUNT) {
+  unsigned bits{1};
+  while (bits < 64 && (std::uint64_t{1} << bits) < COUNT) {
+    ++bits;
+  }
+  return bits;
+}
+
+/**
+ * @brief Packs the action of every transition into a word, from the least significant bit: the flag of scans and
+ *        loops (see IsSummarized), then per tape the code written, the movement (0 to stay, 1 left, 2 right) and
+ *        whether the code is written (see Writes), which it is not if the cell is kept or rewritten with the symbol
+ *        read, then the next state. Identical words are stored once. Nothing is packed if a word would need more than
+ *        64 bits.
+ *
+ * @param NUMBER_OF_TAPES Number of tapes of the DTM.
+ */
+void DispatchTable::PackActions(const unsigned NUMBER_OF_TAPES) {
+  const unsigned SYMBOL_BITS{BitsFor(radix)};
+  fieldBits = SYMBOL_BITS + 3;
+  stateShift = 1 + NUMBER_OF_TAPES * fieldBits;
+  symbolMask = static_cast<SymbolCode>((1u << SYMBOL_BITS) - 1);
+  if (NUMBER_OF_TAPES == 0 || stateShift + BitsFor(NumberOfStates()) > 64) {
+    return;
+  }
+  std::unordered_map<std::uint64_t, unsigned> interned;
+  for (const auto& TRANSITION : transitions) {
+    std::uint64_t action{static_cast<std::uint64_t>(TRANSITION.nextState) << stateShift | (TRANSITION.scanTape != -1 || TRANSITION.loop != -1)};
+    for (unsigned i{0}; i < NUMBER_OF_TAPES; ++i) {
+      const std::uint64_t MOVEMENT{TRANSITION.movements[i] == Movement::LEFT ? 1u : TRANSITION.movements[i] == Movement::RIGHT ? 2u : 0u};
+      const std::uint64_t WRITES{TRANSITION.writeSymbols[i] != SymbolTable::ANY && TRANSITION.writeSymbols[i] != TRANSITION.readSymbols[i]};
+      const std::uint64_t SYMBOL{WRITES ? TRANSITION.writeSymbols[i] : 0u};
+      action |= (SYMBOL | MOVEMENT << SYMBOL_BITS | WRITES << (SYMBOL_BITS + 2)) << (1 + i * fieldBits);
+    }
+    const auto [ENTRY, INSERTED]{interned.emplace(action, actions.size())};
+    if (INSERTED) {
+      actions.emplace_back(action);
+    }
+    slotActions.emplace_back(ENTRY->second);
+  }
+}
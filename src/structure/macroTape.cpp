@@ -0,0 +1,199 @@
+/**
+ * @file macroTape.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to represent a DTM tape as a sequence of blocks of cells.
+ * @date 17/10/2026
+ */
+
+#include "../../include/structure/macroTape.hpp"
+
+/**
+ * @brief Constructs a new blank MacroTape object. The number of distinct blocks, RADIX^BLOCK_SIZE, must not exceed
+ *        SymbolTable::MAX_SYMBOLS, so every block fits in a symbol code other than SymbolTable::ANY.
+ *
+ * @param BLOCK_SIZE Number of cells of a block.
+ * @param RADIX Number of symbols of the tape alphabet.
+ */
+MacroTape::MacroTape(const unsigned BLOCK_SIZE, const unsigned RADIX) : blockSize{BLOCK_SIZE}, radix{RADIX}, block{0}, offset{0}, leftmost{0}, rightmost{0} {
+  SymbolCode power{1};
+  for (unsigned i{0}; i < blockSize; ++i) {
+    powers.emplace_back(power);
+    power *= radix;
+  }
+}
+
+/**
+ * @brief Reads the symbol in the cell under the head.
+ *
+ * @return Code of the symbol under the head.
+ */
+SymbolCode MacroTape::Read() const {
+  return Digit(blocks.Read(), offset);
+}
+
+/**
+ * @brief Returns the block under the head.
+ *
+ * @return The macro symbol of the block.
+ */
+SymbolCode MacroTape::Block() const {
+  return blocks.Read();
+}
+
+/**
+ * @brief Returns the offset of the head inside its block.
+ *
+ * @return The offset, from 0 to the block size minus one.
+ */
+unsigned MacroTape::Offset() const {
+  return offset;
+}
+
+/**
+ * @brief Returns the number of cells of a block.
+ *
+ * @return The block size.
+ */
+unsigned MacroTape::BlockSize() const {
+  return blockSize;
+}
+
+/**
+ * @brief Returns the number of distinct blocks.
+ *
+ * @return The number of symbols of the tape alphabet raised to the block size.
+ */
+std::uint64_t MacroTape::NumberOfBlocks() const {
+  return static_cast<std::uint64_t>(powers.back()) * radix;
+}
+
+/**
+ * @brief Returns the code of a cell of a block.
+ *
+ * @param BLOCK Macro symbol of the block.
+ * @param OFFSET Offset of the cell inside the block.
+ * @return The code of the symbol of the cell.
+ */
+SymbolCode MacroTape::Digit(const SymbolCode BLOCK, const unsigned OFFSET) const {
+  return BLOCK / powers[OFFSET] % radix;
+}
+
+/**
+ * @brief Returns a block with a cell replaced.
+ *
+ * @param BLOCK Macro symbol of the block.
+ * @param OFFSET Offset of the cell inside the block.
+ * @param SYMBOL Code of the symbol to write in the cell.
+ * @return The macro symbol of the block after the write.
+ */
+SymbolCode MacroTape::WithDigit(const SymbolCode BLOCK, const unsigned OFFSET, const SymbolCode SYMBOL) const {
+  return BLOCK - Digit(BLOCK, OFFSET) * powers[OFFSET] + SYMBOL * powers[OFFSET];
+}
+
+/**
+ * @brief Applies a macro step made from the head: writes the block left by the step and moves the head to the
+ *        offset it reached, in the neighbouring block if it left the block.
+ *
+ * @param STEP Macro step to apply.
+ */
+void MacroTape::Apply(const MacroStep& STEP) {
+  blocks.Write(STEP.block);
+  leftmost = std::min(leftmost, block * blockSize + STEP.lowest);
+  rightmost = std::max(rightmost, block * blockSize + STEP.highest);
+  if (STEP.offset < 0) {
+    blocks.MoveHead(Movement::LEFT);
+    --block;
+    offset = blockSize - 1;
+  } else if (STEP.offset >= static_cast<int>(blockSize)) {
+    blocks.MoveHead(Movement::RIGHT);
+    ++block;
+    offset = 0;
+  } else {
+    offset = STEP.offset;
+  }
+}
+
+/**
+ * @brief Applies a macro step that crosses the block under the head from one side to the other to the whole run of
+ *        equal blocks ahead, at most MAX_BLOCKS of them. The step must keep the state, so it applies again on every
+ *        block of the run.
+ *
+ * @param STEP Macro step to chain.
+ * @param MAX_BLOCKS Maximum number of blocks to cross, at least one.
+ * @return The number of blocks crossed.
+ */
+std::uint64_t MacroTape::Chain(const MacroStep& STEP, const std::uint64_t MAX_BLOCKS) {
+  if (STEP.offset < 0) {
+    rightmost = std::max(rightmost, block * blockSize + STEP.highest);
+    const std::uint64_t CROSSED{blocks.Cross(Movement::LEFT, STEP.block, MAX_BLOCKS)};
+    block -= static_cast<std::int64_t>(CROSSED);
+    leftmost = std::min(leftmost, (block + 1) * blockSize + STEP.lowest);
+    offset = blockSize - 1;
+    return CROSSED;
+  }
+  leftmost = std::min(leftmost, block * blockSize + STEP.lowest);
+  const std::uint64_t CROSSED{blocks.Cross(Movement::RIGHT, STEP.block, MAX_BLOCKS)};
+  block += static_cast<std::int64_t>(CROSSED);
+  rightmost = std::max(rightmost, (block - 1) * blockSize + STEP.highest);
+  offset = 0;
+  return CROSSED;
+}
+
+/**
+ * @brief Resets the tape and inserts a sequence of symbols from the head on.
+ *
+ * @param SYMBOLS Codes of the symbols to insert.
+ */
+void MacroTape::InsertSymbols(const std::vector<SymbolCode>& SYMBOLS) {
+  std::vector<SymbolCode> codes((SYMBOLS.size() + blockSize - 1) / blockSize, 0);
+  for (std::size_t i{0}; i < SYMBOLS.size(); ++i) {
+    codes[i / blockSize] += SYMBOLS[i] * powers[i % blockSize];
+  }
+  blocks.InsertSymbols(codes);
+  block = 0;
+  offset = 0;
+  leftmost = 0;
+  rightmost = static_cast<std::int64_t>(std::max<std::size_t>(SYMBOLS.size(), 1)) - 1;
+}
+
+/**
+ * @brief Returns the extent of the tape: the number of cells between the leftmost and the rightmost cells visited by
+ *        the head or holding the input, both included.
+ *
+ * @return The extent of the tape in cells.
+ */
+std::uint64_t MacroTape::Extent() const {
+  return rightmost - leftmost + 1;
+}
+
+/**
+ * @brief Returns the memory reserved by the runs of blocks of the tape.
+ *
+ * @return The memory used by the tape in bytes.
+ */
+std::uint64_t MacroTape::MemoryUsage() const {
+  return blocks.MemoryUsage();
+}
+
+/**
+ * @brief Returns a string representation of the tape, the same as the one of a Tape holding the same cells.
+ *
+ * @param SYMBOLS Symbol table that decodes the cells.
+ * @return A string representation of the tape.
+ */
+const std::string MacroTape::ToString(const SymbolTable& SYMBOLS) const {
+  std::vector<SymbolRun> cells;
+  for (const auto& RUN : blocks.Runs()) {
+    for (std::uint64_t i{0}; i < RUN.length; ++i) {
+      for (unsigned j{0}; j < blockSize; ++j) {
+        const SymbolCode SYMBOL{Digit(RUN.symbol, j)};
+        if (!cells.empty() && cells.back().symbol == SYMBOL) {
+          ++cells.back().length;
+        } else {
+          cells.emplace_back(SymbolRun{SYMBOL, 1});
+        }
+      }
+    }
+  }
+  return RunLengthTape::Format(cells, blocks.Start() * blockSize, block * blockSize + offset, SYMBOLS);
+}
@@ -0,0 +1,245 @@
+/**
+ * @file runLengthTape.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to represent a DTM tape stored as runs of equal symbols.
+ * @date 17/10/2026
+ */
+
+#include <limits>
+#include <numeric>
+
+#include "../../include/structure/runLengthTape.hpp"
+
+/**
+ * @brief Constructs a new blank RunLengthTape object.
+ */
+RunLengthTape::RunLengthTape() {
+  Reset();
+}
+
+/**
+ * @brief Writes a symbol in the current position of the tape, splitting the run that holds the head.
+ *
+ * @param SYMBOL Code of the symbol to write.
+ */
+void RunLengthTape::Write(const SymbolCode SYMBOL) {
+  if (Read() == SYMBOL) {
+    return;
+  }
+  Pop(right, 1);
+  Push(right, SYMBOL, 1);
+}
+
+/**
+ * @brief Reads the symbol in the current position of the tape.
+ *
+ * @return Code of the symbol in the current position of the tape.
+ */
+SymbolCode RunLengthTape::Read() const {
+  return right.empty() ? 0 : right.back().symbol;
+}
+
+/**
+ * @brief Moves the head of the tape to the left, right or stays in the same position, moving the cell it leaves from
+ *        one stack to the other.
+ *
+ * @param MOVEMENT Movement to perform.
+ */
+void RunLengthTape::MoveHead(const Movement& MOVEMENT) {
+  switch (MOVEMENT) {
+    case Movement::LEFT: {
+      const SymbolCode SYMBOL{left.empty() ? SymbolCode{0} : left.back().symbol};
+      Pop(left, 1);
+      Push(right, SYMBOL, 1);
+      leftmost = std::min(leftmost, --position);
+      break;
+    }
+    case Movement::RIGHT: {
+      Push(left, Read(), 1);
+      Pop(right, 1);
+      rightmost = std::max(rightmost, ++position);
+      break;
+    }
+    case Movement::STAY:
+      break;
+  }
+}
+
+/**
+ * @brief Crosses the cells holding the symbol under the head in a direction, as a sequence of movements in that
+ *        direction writing a symbol on every cell they leave would do. The head stops on the first cell holding
+ *        another symbol or after MAX_CELLS movements, whatever comes first. The whole run is crossed in constant
+ *        time, and so is the blank tape beyond the last run.
+ *
+ * @param MOVEMENT Direction of the movements, LEFT or RIGHT.
+ * @param SYMBOL Code of the symbol to write, or SymbolTable::ANY to keep the cells.
+ * @param MAX_CELLS Maximum number of movements, at least one.
+ * @return The number of movements made.
+ */
+std::uint64_t RunLengthTape::Cross(const Movement& MOVEMENT, const SymbolCode SYMBOL, const std::uint64_t MAX_CELLS) {
+  const SymbolCode READ{Read()};
+  const SymbolCode WRITE{SYMBOL == SymbolTable::ANY ? READ : SYMBOL};
+  if (MOVEMENT == Movement::RIGHT) {
+    const std::uint64_t CROSSED{std::min(right.empty() ? MAX_CELLS : right.back().length, MAX_CELLS)};
+    Pop(right, CROSSED);
+    Push(left, WRITE, CROSSED);
+    position += CROSSED;
+    rightmost = std::max(rightmost, position);
+    return CROSSED;
+  }
+  const std::uint64_t BEHIND{left.empty() ? (READ == 0 ? std::numeric_limits<std::uint64_t>::max() : 0) : left.back().symbol == READ ? left.back().length : 0};
+  const std::uint64_t CROSSED{std::min(BEHIND, MAX_CELLS - 1) + 1};
+  Pop(right, 1);
+  Pop(left, CROSSED - 1);
+  Push(right, WRITE, CROSSED);
+  position -= CROSSED - 1;
+  MoveHead(Movement::LEFT);
+  return CROSSED;
+}
+
+/**
+ * @brief Resets the tape and its content.
+ */
+void RunLengthTape::Reset() {
+  left.clear();
+  right.clear();
+  position = 0;
+  leftmost = 0;
+  rightmost = 0;
+}
+
+/**
+ * @brief Resets the tape and inserts a sequence of symbols from the head on.
+ *
+ * @param SYMBOLS Codes of the symbols to insert.
+ */
+void RunLengthTape::InsertSymbols(const std::vector<SymbolCode>& SYMBOLS) {
+  Reset();
+  for (auto symbol{SYMBOLS.rbegin()}; symbol != SYMBOLS.rend(); ++symbol) {
+    Push(right, *symbol, 1);
+  }
+  rightmost = static_cast<std::int64_t>(std::max<std::size_t>(SYMBOLS.size(), 1)) - 1;
+}
+
+/**
+ * @brief Returns the extent of the tape: the number of cells between the leftmost and the rightmost cells visited by
+ *        the head or holding the input, both included.
+ *
+ * @return The extent of the tape in cells.
+ */
+std::uint64_t RunLengthTape::Extent() const {
+  return rightmost - leftmost + 1;
+}
+
+/**
+ * @brief Returns the memory used by the runs of the tape in the current run. The buffers kept from earlier runs are
+ *        not charged, so the usage only depends on the current input.
+ *
+ * @return The memory used by the tape in bytes.
+ */
+std::uint64_t RunLengthTape::MemoryUsage() const {
+  return (left.size() + right.size()) * sizeof(SymbolRun);
+}
+
+/**
+ * @brief Returns the number of runs stored.
+ *
+ * @return The number of runs of both stacks.
+ */
+std::size_t RunLengthTape::NumberOfRuns() const {
+  return left.size() + right.size();
+}
+
+/**
+ * @brief Returns the runs stored, from left to right.
+ *
+ * @return The runs of the tape.
+ */
+std::vector<SymbolRun> RunLengthTape::Runs() const {
+  std::vector<SymbolRun> runs{left};
+  runs.insert(runs.end(), right.rbegin(), right.rend());
+  return runs;
+}
+
+/**
+ * @brief Returns the position of the first cell of the leftmost run stored.
+ *
+ * @return The position relative to the first cell of the input.
+ */
+std::int64_t RunLengthTape::Start() const {
+  return position - std::accumulate(left.begin(), left.end(), std::int64_t{0}, [](const std::int64_t ACCOUNT, const SymbolRun& RUN) { return ACCOUNT + static_cast<std::int64_t>(RUN.length); });
+}
+
+/**
+ * @brief Returns a string representation of the tape, the same as the one of a Tape holding the same cells.
+ *
+ * @param SYMBOLS Symbol table that decodes the cells.
+ * @return A string representation of the tape.
+ */
+const std::string RunLengthTape::ToString(const SymbolTable& SYMBOLS) const {
+  return Format(Runs(), Start(), position, SYMBOLS);
+}
+
+/**
+ * @brief Formats a sequence of runs as Tape::ToString does: from the cell before the first non-blank one (or the head)
+ *        to the cell after the last one, with the head between '>' and '<'.
+ *
+ * @param RUNS Runs to format, from left to right. The cells beyond them are blank.
+ * @param START Position of the first cell of the first run.
+ * @param HEAD Position of the head.
+ * @param SYMBOLS Symbol table that decodes the cells.
+ * @return A string representation of the runs.
+ */
+std::string RunLengthTape::Format(const std::vector<SymbolRun>& RUNS, const std::int64_t START, const std::int64_t HEAD, const SymbolTable& SYMBOLS) {
+  std::int64_t contentStart{HEAD - 1}, contentEnd{HEAD + 1}, runStart{START};
+  for (const auto& RUN : RUNS) {
+    if (RUN.symbol != 0) {
+      contentStart = std::min(contentStart, runStart - 1);
+      contentEnd = std::max(contentEnd, runStart + static_cast<std::int64_t>(RUN.length));
+    }
+    runStart += RUN.length;
+  }
+  std::string result;
+  std::int64_t cell{contentStart};
+  const auto EMIT{[&](const SymbolCode SYMBOL, const std::int64_t END) {
+    for (; cell < END && cell <= contentEnd; ++cell) {
+      result += (cell == HEAD ? ">" : "") + SYMBOLS.Decode(SYMBOL).ToString() + (cell == HEAD ? "<" : "") + " ";
+    }
+  }};
+  EMIT(0, START);
+  runStart = START;
+  for (const auto& RUN : RUNS) {
+    runStart += RUN.length;
+    EMIT(RUN.symbol, runStart);
+  }
+  EMIT(0, contentEnd + 1);
+  return result;
+}
+
+/**
+ * @brief Pushes cells holding a symbol on top of a stack of runs, merging them with the top run if it holds the same
+ *        symbol. Blank cells pushed on an empty stack are dropped, as the tape beyond the stack is blank.
+ */
+void RunLengthTape::Push(std::vector<SymbolRun>& stack, const SymbolCode SYMBOL, const std::uint64_t LENGTH) {
+  if (stack.empty() ? SYMBOL == 0 : stack.back().symbol == SYMBOL) {
+    if (!stack.empty()) {
+      stack.back().length += LENGTH;
+    }
+    return;
+  }
+  stack.emplace_back(SymbolRun{SYMBOL, LENGTH});
+}
+
+/**
+ * @brief Pops cells from the top run of a stack, which must hold at least as many. Popping from an empty stack takes
+ *        cells of the blank tape beyond it.
+ */
+void RunLengthTape::Pop(std::vector<SymbolRun>& stack, const std::uint64_t LENGTH) {
+  if (stack.empty()) {
+    return;
+  }
+  stack.back().length -= LENGTH;
+  if (stack.back().length == 0) {
+    stack.pop_back();
+  }
+}
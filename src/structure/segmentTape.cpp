@@ -0,0 +1,362 @@
+/**
+ * @file segmentTape.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to represent a DTM tape as a tree of hash-consed segments.
+ * @date 17/10/2026
+ */
+
+#include "../../include/structure/segmentTape.hpp"
+
+/**
+ * @brief Constructs a new blank SegmentTape object. The number of distinct blocks, RADIX^BLOCK_SIZE, must not exceed
+ *        SymbolTable::MAX_SYMBOLS (see MacroEngine::FitsBlocks).
+ *
+ * @param BLOCK_SIZE Number of cells of a block.
+ * @param RADIX Number of symbols of the tape alphabet.
+ */
+SegmentTape::SegmentTape(const unsigned BLOCK_SIZE, const unsigned RADIX) : blockSize{BLOCK_SIZE}, radix{RADIX}, blanks{0}, root{0}, height{0}, head{0}, origin{0}, leftmost{0}, rightmost{0} {
+  SymbolCode power{1};
+  for (unsigned i{0}; i < blockSize; ++i) {
+    powers.emplace_back(power);
+    power *= radix;
+  }
+}
+
+/**
+ * @brief Reads the symbol in the cell under the head.
+ *
+ * @return Code of the symbol under the head.
+ */
+SymbolCode SegmentTape::Read() const {
+  const std::uint64_t BLOCK{head / blockSize};
+  std::uint32_t id{root};
+  for (unsigned level{height}; level > 0; --level) {
+    const SegmentNode NODE{Node(id)};
+    id = (BLOCK >> (level - 1) & 1) ? NODE.right : NODE.left;
+  }
+  return Digit(id, head % blockSize);
+}
+
+/**
+ * @brief Returns the position of the head.
+ *
+ * @return The cell under the head, from the first cell of the root.
+ */
+std::uint64_t SegmentTape::Head() const {
+  return head;
+}
+
+/**
+ * @brief Returns the level of the root.
+ *
+ * @return The height of the tree of segments.
+ */
+unsigned SegmentTape::Height() const {
+  return height;
+}
+
+/**
+ * @brief Returns the number of cells of the segments of a level.
+ *
+ * @param LEVEL Level of the segments.
+ * @return The block size times 2^LEVEL.
+ */
+std::int64_t SegmentTape::Cells(const unsigned LEVEL) const {
+  return static_cast<std::int64_t>(blockSize) << LEVEL;
+}
+
+/**
+ * @brief Returns the number of cells of a block.
+ *
+ * @return The block size.
+ */
+unsigned SegmentTape::BlockSize() const {
+  return blockSize;
+}
+
+/**
+ * @brief Returns the number of distinct blocks, which is also the id of the first segment of two blocks.
+ *
+ * @return The number of symbols of the tape alphabet raised to the block size.
+ */
+std::uint64_t SegmentTape::NumberOfBlocks() const {
+  return static_cast<std::uint64_t>(powers.back()) * radix;
+}
+
+/**
+ * @brief Returns the number of segments of two or more blocks created so far.
+ *
+ * @return The number of nodes.
+ */
+std::size_t SegmentTape::NumberOfNodes() const {
+  return nodes.size();
+}
+
+/**
+ * @brief Returns the code of a cell of a block.
+ *
+ * @param BLOCK Macro symbol of the block.
+ * @param OFFSET Offset of the cell inside the block.
+ * @return The code of the symbol of the cell.
+ */
+SymbolCode SegmentTape::Digit(const SymbolCode BLOCK, const unsigned OFFSET) const {
+  return BLOCK / powers[OFFSET] % radix;
+}
+
+/**
+ * @brief Returns a block with a cell replaced.
+ *
+ * @param BLOCK Macro symbol of the block.
+ * @param OFFSET Offset of the cell inside the block.
+ * @param SYMBOL Code of the symbol to write in the cell.
+ * @return The macro symbol of the block after the write.
+ */
+SymbolCode SegmentTape::WithDigit(const SymbolCode BLOCK, const unsigned OFFSET, const SymbolCode SYMBOL) const {
+  return BLOCK - Digit(BLOCK, OFFSET) * powers[OFFSET] + SYMBOL * powers[OFFSET];
+}
+
+/**
+ * @brief Returns the halves of a segment of two or more blocks.
+ *
+ * @param ID Id of the segment.
+ * @return The node of the segment.
+ */
+SegmentNode SegmentTape::Node(const std::uint32_t ID) const {
+  return nodes[ID - NumberOfBlocks()];
+}
+
+/**
+ * @brief Returns the segment made of two segments of the same level, creating it if it does not exist yet.
+ *
+ * @param LEFT Id of the left half.
+ * @param RIGHT Id of the right half.
+ * @return The id of the segment.
+ */
+std::uint32_t SegmentTape::Join(const std::uint32_t LEFT, const std::uint32_t RIGHT) {
+  const std::uint64_t KEY{static_cast<std::uint64_t>(LEFT) << 32 | RIGHT};
+  const auto FOUND{ids.find(KEY)};
+  if (FOUND != ids.end()) {
+    return FOUND->second;
+  }
+  const std::uint32_t ID{static_cast<std::uint32_t>(NumberOfBlocks() + nodes.size())};
+  nodes.emplace_back(SegmentNode{LEFT, RIGHT});
+  ids.emplace(KEY, ID);
+  return ID;
+}
+
+/**
+ * @brief Returns the segments holding the head, one per level.
+ *
+ * @param path Buffer where the ids of the segments are stored, the block under the head first and the root last.
+ */
+void SegmentTape::Path(std::vector<std::uint32_t>& path) const {
+  const std::uint64_t BLOCK{head / blockSize};
+  path.resize(height + 1);
+  path[height] = root;
+  for (unsigned level{height}; level > 0; --level) {
+    const SegmentNode NODE{Node(path[level])};
+    path[level - 1] = (BLOCK >> (level - 1) & 1) ? NODE.right : NODE.left;
+  }
+}
+
+/**
+ * @brief Replaces a segment holding the head, rebuilding the segments above it.
+ *
+ * @param PATH Segments holding the head, as returned by Path.
+ * @param LEVEL Level of the segment to replace.
+ * @param ID Id of the new segment.
+ */
+void SegmentTape::Replace(const std::vector<std::uint32_t>& PATH, const unsigned LEVEL, const std::uint32_t ID) {
+  const std::uint64_t BLOCK{head / blockSize};
+  std::uint32_t id{ID};
+  for (unsigned level{LEVEL + 1}; level <= height; ++level) {
+    const SegmentNode NODE{Node(PATH[level])};
+    id = (BLOCK >> (level - 1) & 1) ? Join(NODE.left, id) : Join(id, NODE.right);
+  }
+  root = id;
+}
+
+/**
+ * @brief Moves the head to a cell, growing the root with blank segments until it holds the cell.
+ *
+ * @param CELL Cell to move to, from the first cell of the root.
+ */
+void SegmentTape::MoveHead(const std::int64_t CELL) {
+  std::int64_t cell{CELL};
+  while (cell < 0) {
+    cell += Cells(height);
+    origin += Cells(height);
+    root = Join(Blank(height), root);
+    ++height;
+  }
+  while (cell >= Cells(height)) {
+    root = Join(root, Blank(height));
+    ++height;
+  }
+  head = cell;
+}
+
+/**
+ * @brief Records the cells visited by the head.
+ *
+ * @param LOWEST Leftmost cell visited, from the first cell of the root.
+ * @param HIGHEST Rightmost cell visited, from the first cell of the root.
+ */
+void SegmentTape::Visit(const std::int64_t LOWEST, const std::int64_t HIGHEST) {
+  leftmost = std::min(leftmost, LOWEST - origin);
+  rightmost = std::max(rightmost, HIGHEST - origin);
+}
+
+/**
+ * @brief Replaces the tape with a sequence of symbols from the head on. The segments created so far are kept.
+ *
+ * @param SYMBOLS Codes of the symbols to insert.
+ */
+void SegmentTape::InsertSymbols(const std::vector<SymbolCode>& SYMBOLS) {
+  std::vector<std::uint32_t> level(std::max<std::size_t>((SYMBOLS.size() + blockSize - 1) / blockSize, 1), 0);
+  for (std::size_t i{0}; i < SYMBOLS.size(); ++i) {
+    level[i / blockSize] += SYMBOLS[i] * powers[i % blockSize];
+  }
+  height = 0;
+  while (level.size() > 1) {
+    if (level.size() % 2 != 0) {
+      level.emplace_back(Blank(height));
+    }
+    for (std::size_t i{0}; i < level.size() / 2; ++i) {
+      level[i] = Join(level[2 * i], level[2 * i + 1]);
+    }
+    level.resize(level.size() / 2);
+    ++height;
+  }
+  root = level[0];
+  head = 0;
+  origin = 0;
+  leftmost = 0;
+  rightmost = static_cast<std::int64_t>(std::max<std::size_t>(SYMBOLS.size(), 1)) - 1;
+}
+
+/**
+ * @brief Drops the segments the tape does not hold, renumbering the others. The ids returned before are no longer valid.
+ */
+void SegmentTape::Compact() {
+  std::vector<SegmentNode> former;
+  std::unordered_map<std::uint32_t, std::uint32_t> copies;
+  former.swap(nodes);
+  ids.clear();
+  blanks.assign(1, 0);
+  root = Copy(root, height, former, copies);
+}
+
+/**
+ * @brief Returns the extent of the tape: the number of cells between the leftmost and the rightmost cells visited by
+ *        the head or holding the input, both included.
+ *
+ * @return The extent of the tape in cells.
+ */
+std::uint64_t SegmentTape::Extent() const {
+  return rightmost - leftmost + 1;
+}
+
+/**
+ * @brief Returns the memory used by the segments the tape holds in the current run, each counted once. The segments
+ *        kept from earlier runs, or no longer held, are not charged, so the usage only depends on the current input.
+ *
+ * @return The memory used by the tape in bytes.
+ */
+std::uint64_t SegmentTape::MemoryUsage() const {
+  std::vector<bool> counted(nodes.size(), false);
+  std::vector<std::pair<std::uint32_t, unsigned>> pending{{root, height}};
+  std::uint64_t held{0};
+  while (!pending.empty()) {
+    const auto [ID, LEVEL]{pending.back()};
+    pending.pop_back();
+    if (LEVEL == 0 || counted[ID - NumberOfBlocks()]) {
+      continue;
+    }
+    counted[ID - NumberOfBlocks()] = true;
+    ++held;
+    const SegmentNode NODE{Node(ID)};
+    pending.emplace_back(NODE.left, LEVEL - 1);
+    pending.emplace_back(NODE.right, LEVEL - 1);
+  }
+  return held * (sizeof(SegmentNode) + sizeof(std::pair<const std::uint64_t, std::uint32_t>) + 2 * sizeof(void*));
+}
+
+/**
+ * @brief Returns a string representation of the tape, the same as the one of a Tape holding the same cells.
+ *
+ * @param SYMBOLS Symbol table that decodes the cells.
+ * @return A string representation of the tape.
+ */
+const std::string SegmentTape::ToString(const SymbolTable& SYMBOLS) const {
+  std::vector<SymbolRun> cells;
+  Collect(root, height, cells);
+  return RunLengthTape::Format(cells, -origin, static_cast<std::int64_t>(head) - origin, SYMBOLS);
+}
+
+/**
+ * @brief Returns the all-blank segment of a level, creating it if it does not exist yet.
+ *
+ * @param LEVEL Level of the segment.
+ * @return The id of the segment.
+ */
+std::uint32_t SegmentTape::Blank(const unsigned LEVEL) {
+  while (blanks.size() <= LEVEL) {
+    blanks.emplace_back(Join(blanks.back(), blanks.back()));
+  }
+  return blanks[LEVEL];
+}
+
+/**
+ * @brief Copies a segment, and the segments it is made of, from a former set of nodes to the current one.
+ *
+ * @param ID Id of the segment among the former nodes.
+ * @param LEVEL Level of the segment.
+ * @param FORMER Former nodes.
+ * @param copies Ids of the segments copied so far, by their former ids.
+ * @return The id of the copy.
+ */
+std::uint32_t SegmentTape::Copy(const std::uint32_t ID, const unsigned LEVEL, const std::vector<SegmentNode>& FORMER, std::unordered_map<std::uint32_t, std::uint32_t>& copies) {
+  if (LEVEL == 0) {
+    return ID;
+  }
+  const auto FOUND{copies.find(ID)};
+  if (FOUND != copies.end()) {
+    return FOUND->second;
+  }
+  const SegmentNode NODE{FORMER[ID - NumberOfBlocks()]};
+  const std::uint32_t LEFT{Copy(NODE.left, LEVEL - 1, FORMER, copies)};
+  const std::uint32_t COPY{Join(LEFT, Copy(NODE.right, LEVEL - 1, FORMER, copies))};
+  copies.emplace(ID, COPY);
+  return COPY;
+}
+
+/**
+ * @brief Appends the cells of a segment to a sequence of runs. All-blank segments are appended as a single run.
+ *
+ * @param ID Id of the segment.
+ * @param LEVEL Level of the segment.
+ * @param cells Runs the cells are appended to.
+ */
+void SegmentTape::Collect(const std::uint32_t ID, const unsigned LEVEL, std::vector<SymbolRun>& cells) const {
+  const auto APPEND{[&cells](const SymbolCode SYMBOL, const std::uint64_t LENGTH) {
+    if (!cells.empty() && cells.back().symbol == SYMBOL) {
+      cells.back().length += LENGTH;
+    } else {
+      cells.emplace_back(SymbolRun{SYMBOL, LENGTH});
+    }
+  }};
+  if (LEVEL < blanks.size() && ID == blanks[LEVEL]) {
+    APPEND(0, Cells(LEVEL));
+    return;
+  }
+  if (LEVEL == 0) {
+    for (unsigned i{0}; i < blockSize; ++i) {
+      APPEND(Digit(ID, i), 1);
+    }
+    return;
+  }
+  const SegmentNode NODE{Node(ID)};
+  Collect(NODE.left, LEVEL - 1, cells);
+  Collect(NODE.right, LEVEL - 1, cells);
+}
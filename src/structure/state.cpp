@@ -9,40 +9,11 @@
 
 /**
  * @brief Constructs a new State object.
- * 
- * @param NAME Name of the state.
  */
-State::State(const std::string& NAME) : name(NAME) {
+State::State() {
   isFinal = false;
 }
 
-/**
- * @brief Returns the name of the state.
- * 
- * @return The name of the state.
- */
-const std::string& State::ToString() const { 
-  return name; 
-}
-
-/**
- * @brief Returns a read-only reference to the transitions of the state.
- * 
- * @return A read-only reference to the transitions of the state.
- */
-const TransitionSet& State::Transitions() const { 
-  return transitions; 
-}
-
-/**
- * @brief Returns a reference to the transitions of the state.
- * 
- * @return A reference to the transitions of the state.
- */
-TransitionSet& State::Transitions() { 
-  return transitions;
-}
-
 /**
  * @brief Sets the state as final.
  */
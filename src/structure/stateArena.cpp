@@ -0,0 +1,97 @@
+/**
+ * @file stateArena.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to store the states of a DTM contiguously.
+ * @date 17/10/2026
+ */
+
+#include "../../include/structure/stateArena.hpp"
+
+/**
+ * @brief Adds a state without transitions. Adding a name twice returns the state already added.
+ *
+ * @param NAME Name of the state.
+ * @return The id of the state.
+ */
+StateId StateArena::Add(const std::string& NAME) {
+  const auto [ENTRY, INSERTED]{ids.emplace(NAME, states.size())};
+  if (INSERTED) {
+    states.emplace_back();
+    names.emplace_back(NAME);
+  }
+  return ENTRY->second;
+}
+
+/**
+ * @brief Checks if there is a state with a given name.
+ *
+ * @param NAME Name of the state.
+ * @return true If the state was added.
+ * @return false If there is no state with that name.
+ */
+bool StateArena::Contains(const std::string& NAME) const {
+  return ids.find(NAME) != ids.end();
+}
+
+/**
+ * @brief Returns the id of a state.
+ *
+ * @param NAME Name of the state.
+ * @return The id of the state.
+ * @throw std::out_of_range If there is no state with that name.
+ */
+StateId StateArena::Id(const std::string& NAME) const {
+  return ids.at(NAME);
+}
+
+/**
+ * @brief Returns a reference to a state.
+ *
+ * @param ID Id of the state.
+ * @return A reference to the state, valid until another state is added.
+ */
+State& StateArena::At(const StateId ID) {
+  return states[ID];
+}
+
+/**
+ * @brief Returns a read-only reference to a state.
+ *
+ * @param ID Id of the state.
+ * @return A read-only reference to the state, valid until another state is added.
+ */
+const State& StateArena::At(const StateId ID) const {
+  return states[ID];
+}
+
+/**
+ * @brief Returns the name of a state.
+ *
+ * @param ID Id of the state.
+ * @return The name of the state.
+ */
+const std::string& StateArena::Name(const StateId ID) const {
+  return names[ID];
+}
+
+/**
+ * @brief Returns the number of states. Their ids go from 0 to this number minus one.
+ *
+ * @return The number of states.
+ */
+unsigned StateArena::Size() const {
+  return states.size();
+}
+
+/**
+ * @brief Returns the names of the states separated by spaces, in the order of their ids.
+ *
+ * @return A string representation of the states.
+ */
+std::string StateArena::ToString() const {
+  std::string result;
+  for (const auto& NAME : names) {
+    result += NAME + " ";
+  }
+  return result;
+}
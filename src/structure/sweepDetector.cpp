@@ -0,0 +1,135 @@
+/**
+ * @file sweepDetector.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to detect DTM runs that sweep into blank tape forever.
+ * @date 17/10/2026
+ */
+
+#include "../../include/structure/sweepDetector.hpp"
+
+/**
+ * @brief Number of cells saved at each side of every head. Cycles that visit cells further from the position of the
+ *        head at the snapshot are not detected.
+ */
+const std::int64_t SweepDetector::WINDOW{256};
+
+/**
+ * @brief Constructs a new SweepDetector object.
+ */
+SweepDetector::SweepDetector() : records{0}, power{1}, diverging{false}, saved{false},
+                             savedState{0}, savedTape{0}, savedDirection{Movement::STAY} {}
+
+/**
+ * @brief Starts tracking a run that has just been loaded.
+ *
+ * @param CONTEXT Execution context of the run.
+ */
+void SweepDetector::Reset(const ExecutionContext& CONTEXT) {
+  leftmost.clear();
+  rightmost.clear();
+  for (const auto& TAPE : CONTEXT.tapes) {
+    leftmost.emplace_back(TAPE.Leftmost());
+    rightmost.emplace_back(TAPE.Rightmost());
+  }
+  records = 0;
+  power = 1;
+  diverging = false;
+  saved = false;
+}
+
+/**
+ * @brief Tracks the cells visited by a step and, if it is a record, compares it against the snapshot or saves it.
+ *
+ * @param CONTEXT Execution context of the run, after the step.
+ * @return true If the step closed a translated cycle, so the run never halts.
+ * @return false Otherwise.
+ */
+bool SweepDetector::Check(const ExecutionContext& CONTEXT) {
+  int recordTape{-1};
+  Movement direction{Movement::STAY};
+  for (unsigned i{0}; i < CONTEXT.tapes.size(); ++i) {
+    const std::int64_t POSITION{CONTEXT.tapes[i].Position()};
+    if (saved) {
+      lowest[i] = std::min(lowest[i], POSITION);
+      highest[i] = std::max(highest[i], POSITION);
+    }
+    if (POSITION < leftmost[i]) {
+      leftmost[i] = POSITION;
+      if (recordTape == -1) {
+        recordTape = i;
+        direction = Movement::LEFT;
+      }
+    } else if (POSITION > rightmost[i]) {
+      rightmost[i] = POSITION;
+      if (recordTape == -1) {
+        recordTape = i;
+        direction = Movement::RIGHT;
+      }
+    }
+  }
+  if (recordTape == -1) {
+    return false;
+  }
+  if (saved && CONTEXT.state == savedState && static_cast<unsigned>(recordTape) == savedTape && direction == savedDirection && Matches(CONTEXT)) {
+    diverging = true;
+    return true;
+  }
+  if (++records == power) {
+    Save(CONTEXT, recordTape, direction);
+    power *= 2;
+  }
+  return false;
+}
+
+/**
+ * @brief Checks if the run being tracked entered a translated cycle.
+ *
+ * @return true If the run never halts.
+ * @return false Otherwise.
+ */
+bool SweepDetector::Diverging() const {
+  return diverging;
+}
+
+/**
+ * @brief Saves the state and the cells around every head at a record.
+ */
+void SweepDetector::Save(const ExecutionContext& CONTEXT, const unsigned RECORD_TAPE, const Movement DIRECTION) {
+  saved = true;
+  savedState = CONTEXT.state;
+  savedTape = RECORD_TAPE;
+  savedDirection = DIRECTION;
+  savedPositions.clear();
+  savedCells.clear();
+  for (const auto& TAPE : CONTEXT.tapes) {
+    const std::int64_t POSITION{TAPE.Position()};
+    savedPositions.emplace_back(POSITION);
+    for (std::int64_t offset{-WINDOW}; offset <= WINDOW; ++offset) {
+      savedCells.emplace_back(TAPE.At(POSITION + offset));
+    }
+  }
+  lowest = savedPositions;
+  highest = savedPositions;
+}
+
+/**
+ * @brief Checks if the cells visited by every head since the snapshot are found now shifted by the distance the head
+ *        moved, with only blanks beyond them in the direction of the movement.
+ */
+bool SweepDetector::Matches(const ExecutionContext& CONTEXT) const {
+  for (unsigned i{0}; i < CONTEXT.tapes.size(); ++i) {
+    const Tape& TAPE{CONTEXT.tapes[i]};
+    const std::int64_t SHIFT{TAPE.Position() - savedPositions[i]};
+    if (lowest[i] < savedPositions[i] - WINDOW || highest[i] > savedPositions[i] + WINDOW ||
+        (SHIFT > 0 && highest[i] != rightmost[i]) || (SHIFT < 0 && lowest[i] != leftmost[i])) {
+      return false;
+    }
+    const std::int64_t FIRST_CELL{static_cast<std::int64_t>(i) * (2 * WINDOW + 1) + WINDOW - savedPositions[i]};
+    for (std::int64_t position{lowest[i]}; position <= highest[i]; ++position) {
+      if (savedCells[FIRST_CELL + position] != TAPE.At(position + SHIFT)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
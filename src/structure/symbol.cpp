@@ -17,31 +17,14 @@ const Symbol Symbol::EPSILON{'.'};
  * 
  * @param VALUE Character value of the symbol.
  */
-Symbol::Symbol(const char VALUE) : value(VALUE) {}
+Symbol::Symbol(const char VALUE) : value(1, VALUE) {}
 
 /**
  * @brief Constructs a new Symbol object.
  * 
  * @param VALUE String value of the symbol.
  */
-Symbol::Symbol(const std::string& VALUE) : value(VALUE[0]) {}
-
-/**
- * @brief Converts a string to a vector of symbols.
- * 
- * @param INPUT_STR String to convert.
- * @return The vector of symbols.
- */
-std::vector<Symbol> Symbol::ToSymbols(const std::string& INPUT_STR) {
-  std::vector<Symbol> symbols;
-  for (const char SYMBOL_VALUE : INPUT_STR) {
-    if (SYMBOL_VALUE == EPSILON.value) {
-      continue;
-    }
-    symbols.emplace_back(Symbol{SYMBOL_VALUE});
-  }
-  return symbols;
-}
+Symbol::Symbol(const std::string& VALUE) : value(VALUE) {}
 
 /**
  * @brief Compares two symbols.
@@ -77,16 +60,12 @@ bool Symbol::operator<(const Symbol& OTHER) const {
 }
 
 /**
- * @brief Copy assignment operator.
+ * @brief Returns the raw characters of the symbol.
  * 
- * @param OTHER Symbol to assign from.
- * @return Reference to this symbol.
+ * @return The characters of the symbol.
  */
-Symbol& Symbol::operator=(const Symbol& OTHER) {
-  if (this != &OTHER) {
-    value = OTHER.value;
-  }
-  return *this;
+const std::string& Symbol::Value() const {
+  return value;
 }
 
 /**
@@ -95,5 +74,5 @@ Symbol& Symbol::operator=(const Symbol& OTHER) {
  * @return The string representation of the symbol.
  */
 const std::string Symbol::ToString() const {
-  return std::string{value};
+  return value;
 }
\ No newline at end of file
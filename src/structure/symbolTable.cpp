@@ -0,0 +1,89 @@
+/**
+ * @file symbolTable.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to intern the symbols of a tape alphabet into dense codes.
+ * @date 17/10/2026
+ */
+
+#include <stdexcept>
+
+#include "../../include/structure/symbolTable.hpp"
+
+/**
+ * @brief Maximum number of symbols of a tape alphabet: the number of codes of a 16-bit cell but ANY.
+ */
+const unsigned SymbolTable::MAX_SYMBOLS{(1u << 16) - 1};
+
+/**
+ * @brief Code that no symbol gets: a transition reading it reads any symbol, and a transition writing it keeps the
+ *        symbol under the head.
+ */
+const SymbolCode SymbolTable::ANY{static_cast<SymbolCode>(MAX_SYMBOLS)};
+
+/**
+ * @brief Constructs a new SymbolTable object. The blank symbol gets the code 0 and the other symbols the next codes,
+ *        in the order of the alphabet.
+ *
+ * @param TAPE_ALPHABET Tape alphabet of the DTM, which contains the blank symbol.
+ * @param BLANK_SYMBOL Blank symbol of the DTM.
+ * @throw std::invalid_argument If the tape alphabet has more than MAX_SYMBOLS symbols.
+ */
+SymbolTable::SymbolTable(const Alphabet& TAPE_ALPHABET, const Symbol& BLANK_SYMBOL) : symbols{BLANK_SYMBOL} {
+  if (TAPE_ALPHABET.size() > MAX_SYMBOLS) {
+    throw std::invalid_argument{"Reading file error: Tape alphabet too large (" + std::to_string(TAPE_ALPHABET.size()) + " symbols, at most " + std::to_string(MAX_SYMBOLS) + ")"};
+  }
+  codes.emplace(BLANK_SYMBOL.Value(), 0);
+  for (const auto& SYMBOL : TAPE_ALPHABET) {
+    if (SYMBOL == BLANK_SYMBOL) {
+      continue;
+    }
+    codes.emplace(SYMBOL.Value(), symbols.size());
+    symbols.emplace_back(SYMBOL);
+  }
+}
+
+/**
+ * @brief Returns the code of a symbol of the alphabet.
+ *
+ * @param SYMBOL Symbol to encode.
+ * @return The code of the symbol.
+ * @throw std::out_of_range If the symbol is not in the alphabet.
+ */
+SymbolCode SymbolTable::Code(const Symbol& SYMBOL) const {
+  return codes.at(SYMBOL.Value());
+}
+
+/**
+ * @brief Returns the symbol of a code.
+ *
+ * @param CODE Code to decode.
+ * @return The symbol with that code.
+ */
+const Symbol& SymbolTable::Decode(const SymbolCode CODE) const {
+  return symbols[CODE];
+}
+
+/**
+ * @brief Returns the number of symbols of the alphabet. Their codes go from 0 to this number minus one.
+ *
+ * @return The number of symbols.
+ */
+unsigned SymbolTable::Size() const {
+  return symbols.size();
+}
+
+/**
+ * @brief Returns the number of bits needed by a tape cell: 1 for binary alphabets, 2 for alphabets of up to 4
+ *        symbols, 8 for alphabets of up to 256 symbols and 16 otherwise.
+ *
+ * @return The number of bits of a cell.
+ */
+unsigned SymbolTable::CellBits() const {
+  if (symbols.size() <= 2) {
+    return 1;
+  }
+  if (symbols.size() <= 4) {
+    return 2;
+  }
+  return symbols.size() <= 256 ? 8 : 16;
+}
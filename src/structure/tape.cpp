@@ -5,38 +5,49 @@
  * @date 19/10/2024
  */
 
+#include <array>
+#include <cstring>
+
 #include "../../include/structure/tape.hpp"
+#include "../../include/utils/byteScan.hpp"
+
+/**
+ * @brief Minimum number of blank bytes added when the tape grows.
+ */
+const unsigned Tape::MIN_GROWTH{16};
 
 /**
  * @brief Constructs a new Tape object.
- * 
- * @param BLANK_SYMBOL Blank symbol of the tape.
+ *
+ * @param CELL_BITS Number of bits of a cell: 1, 2, 8 or 16 (see SymbolTable::CellBits).
  */
-Tape::Tape(const Symbol& BLANK_SYMBOL) : blankSymbol{BLANK_SYMBOL} {
+Tape::Tape(const unsigned CELL_BITS) : cellBits{CELL_BITS}, shift{CELL_BITS == 1 ? 3u : CELL_BITS == 2 ? 2u : 0u} {
   Reset();
 }
 
 /**
  * @brief Writes a symbol in the current position of the tape.
- * 
- * @param SYMBOL Symbol to write.
+ *
+ * @param SYMBOL Code of the symbol to write.
  */
-void Tape::Write(const Symbol& SYMBOL) {
-  symbols[head] = SYMBOL;
+void Tape::Write(const SymbolCode SYMBOL) {
+  SetCell(head, SYMBOL);
 }
 
 /**
  * @brief Reads the symbol in the current position of the tape.
- * 
- * @return Symbol in the current position of the tape.
+ *
+ * @return Code of the symbol in the current position of the tape.
  */
-const Symbol& Tape::Read() const {
-  return symbols[head];
+SymbolCode Tape::Read() const {
+  return Cell(head);
 }
 
 /**
- * @brief Moves the head of the tape to the left, right or stays in the same position.
- * 
+ * @brief Moves the head of the tape to the left, right or stays in the same position. The tape keeps at least one
+ *        blank cell at each side of the head; when one of them is consumed, the tape grows on that side as many cells
+ *        as it already has, so sweeping over fresh cells costs amortized O(1) per movement.
+ *
  * @param MOVEMENT Movement to perform.
  */
 void Tape::MoveHead(const Movement& MOVEMENT) {
@@ -44,16 +55,17 @@ void Tape::MoveHead(const Movement& MOVEMENT) {
     case Movement::LEFT: {
       --head;
       if (head == 0) {
-        symbols.insert(symbols.begin(), blankSymbol);
-        ++head;
+        GrowLeft();
       }
+      leftmost = std::min(leftmost, head);
       break;
     }
     case Movement::RIGHT: {
       ++head;
-      if (head == symbols.size() - 1) {
-        symbols.emplace_back(blankSymbol);
+      if (head == Size() - 1) {
+        GrowRight();
       }
+      rightmost = std::max(rightmost, head);
       break;
     }
     case Movement::STAY:
@@ -61,52 +73,395 @@ void Tape::MoveHead(const Movement& MOVEMENT) {
   }
 }
 
+/**
+ * @brief Moves the head over the cells holding symbols of a set, as a sequence of movements in the same direction
+ *        that do not modify the tape would do. The head stops on the first cell outside the set, on the last cell
+ *        already allocated (the tape is not grown) or after MAX_CELLS movements, whatever comes first.
+ *
+ * @param SYMBOLS Codes of the symbols of the set.
+ * @param MOVEMENT Direction of the movements.
+ * @param MAX_CELLS Maximum number of movements.
+ * @return The number of movements made.
+ */
+std::uint64_t Tape::Scan(const std::vector<SymbolCode>& SYMBOLS, const Movement& MOVEMENT, const std::uint64_t MAX_CELLS) {
+  std::uint64_t span{0};
+  std::array<unsigned char, 256> bytes;
+  if (cellBits == 8) {
+    std::copy(SYMBOLS.begin(), SYMBOLS.end(), bytes.begin());
+  }
+  if (MOVEMENT == Movement::RIGHT) {
+    const std::uint64_t LENGTH{std::min(Size() - 2 - head, MAX_CELLS)};
+    span = cellBits == 8 ? SpanForward(cells.data() + head, LENGTH, bytes.data(), SYMBOLS.size()) : ScanCells(SYMBOLS, MOVEMENT, LENGTH);
+    head += span;
+    rightmost = std::max(rightmost, head);
+  } else if (MOVEMENT == Movement::LEFT) {
+    const std::uint64_t LENGTH{std::min(head - 1, MAX_CELLS)};
+    span = cellBits == 8 ? SpanBackward(cells.data() + head - LENGTH + 1, LENGTH, bytes.data(), SYMBOLS.size()) : ScanCells(SYMBOLS, MOVEMENT, LENGTH);
+    head -= span;
+    leftmost = std::min(leftmost, head);
+  }
+  return span;
+}
+
+/**
+ * @brief Counts the cells from the head, in a direction, that match a periodic pattern: the k-th cell must hold
+ *        PATTERN[k % PATTERN.size()], unless it is SymbolTable::ANY. Like Scan, the count stops on the last cell
+ *        already allocated, so the head can move over all the matched cells without growing the tape.
+ *
+ * @param PATTERN Codes of the symbols of a period of the pattern.
+ * @param MOVEMENT Direction of the cells.
+ * @param MAX_CELLS Maximum number of cells.
+ * @return The number of cells matched.
+ */
+std::uint64_t Tape::Match(const std::vector<SymbolCode>& PATTERN, const Movement& MOVEMENT, const std::uint64_t MAX_CELLS) const {
+  const bool RIGHT{MOVEMENT == Movement::RIGHT};
+  const std::uint64_t LENGTH{RIGHT ? std::min(Size() - 2 - head, MAX_CELLS) : MOVEMENT == Movement::LEFT ? std::min(head - 1, MAX_CELLS) : 0};
+  if (std::all_of(PATTERN.begin(), PATTERN.end(), [](const SymbolCode SYMBOL) { return SYMBOL == SymbolTable::ANY; })) {
+    return LENGTH;
+  }
+  if (PATTERN.size() == 1) {
+    if (cellBits != 8) {
+      return ScanCells(PATTERN, MOVEMENT, LENGTH);
+    }
+    const unsigned char BYTE{static_cast<unsigned char>(PATTERN.front())};
+    return RIGHT ? SpanForward(cells.data() + head, LENGTH, &BYTE, 1) : SpanBackward(cells.data() + head - LENGTH + 1, LENGTH, &BYTE, 1);
+  }
+  std::uint64_t matched{0};
+  for (unsigned phase{0}; matched < LENGTH; ++matched) {
+    if (PATTERN[phase] != SymbolTable::ANY && Cell(RIGHT ? head + matched : head - matched) != PATTERN[phase]) {
+      break;
+    }
+    phase = phase + 1 == PATTERN.size() ? 0 : phase + 1;
+  }
+  return matched;
+}
+
+/**
+ * @brief Writes a periodic pattern over the cells from the head in a direction, as Match reads it, and moves the head
+ *        past them, as a sequence of writes and movements would do. Codes SymbolTable::ANY keep their cells. A
+ *        pattern of a single symbol is written with whole-byte fills.
+ *
+ * @param PATTERN Codes of the symbols of a period of the pattern.
+ * @param MOVEMENT Direction of the cells.
+ * @param CELLS Number of cells to write, at most the number matched by Match.
+ */
+void Tape::Fill(const std::vector<SymbolCode>& PATTERN, const Movement& MOVEMENT, const std::uint64_t CELLS) {
+  if (MOVEMENT == Movement::STAY || CELLS == 0) {
+    return;
+  }
+  const bool RIGHT{MOVEMENT == Movement::RIGHT};
+  const std::uint64_t FIRST{RIGHT ? head : head - CELLS + 1};
+  if (PATTERN.size() == 1 && PATTERN.front() != SymbolTable::ANY) {
+    const SymbolCode SYMBOL{PATTERN.front()};
+    std::uint64_t index{FIRST};
+    const std::uint64_t END{FIRST + CELLS};
+    if (cellBits == 8) {
+      std::memset(cells.data() + FIRST, SYMBOL, CELLS);
+      index = END;
+    } else if (cellBits < 8) {
+      const std::uint64_t LOW_MASK{(1u << shift) - 1};
+      for (; index < END && (index & LOW_MASK) != 0; ++index) {
+        SetCell(index, SYMBOL);
+      }
+      std::uint8_t uniform{0};
+      for (unsigned i{0}; i < 8u; i += cellBits) {
+        uniform |= SYMBOL << i;
+      }
+      const std::uint64_t BYTES{(END - index) >> shift};
+      std::memset(cells.data() + (index >> shift), uniform, BYTES);
+      index += BYTES << shift;
+    }
+    for (; index < END; ++index) {
+      SetCell(index, SYMBOL);
+    }
+  } else if (std::any_of(PATTERN.begin(), PATTERN.end(), [](const SymbolCode SYMBOL) { return SYMBOL != SymbolTable::ANY; })) {
+    unsigned phase{0};
+    for (std::uint64_t i{0}; i < CELLS; ++i) {
+      if (PATTERN[phase] != SymbolTable::ANY) {
+        SetCell(RIGHT ? head + i : head - i, PATTERN[phase]);
+      }
+      phase = phase + 1 == PATTERN.size() ? 0 : phase + 1;
+    }
+  }
+  if (RIGHT) {
+    head += CELLS;
+    rightmost = std::max(rightmost, head);
+  } else {
+    head -= CELLS;
+    leftmost = std::min(leftmost, head);
+  }
+}
+
+/**
+ * @brief Exposes the cells, the head and the visited extents of a tape of byte or 16-bit cells to generated code.
+ *
+ * @return A view of the tape, valid until the tape grows.
+ */
+RawTape Tape::Expose() {
+  return RawTape{cells.data(), Size(), head, leftmost, rightmost};
+}
+
+/**
+ * @brief Takes back the head and the visited extents of a view returned by Expose and grows the tape if the head
+ *        was left on its first or last cell.
+ *
+ * @param RAW View of the tape modified by generated code.
+ */
+void Tape::Absorb(const RawTape& RAW) {
+  head = RAW.head;
+  leftmost = RAW.leftmost;
+  rightmost = RAW.rightmost;
+  if (head == 0) {
+    GrowLeft();
+  } else if (head == Size() - 1) {
+    GrowRight();
+  }
+}
+
 /**
  * @brief Resets the tape and its content.
  */
 void Tape::Reset() {
   head = 1;
-  symbols.clear();
-  symbols.resize(3, blankSymbol);
+  origin = head;
+  leftmost = head;
+  rightmost = head;
+  cells.clear();
+  cells.resize(cellBits == 16 ? 6 : shift == 0 ? 3 : 1, 0);
 }
 
 /**
  * @brief Resets the tape and inserts a sequence of symbols.
- * 
- * @param SYMBOLS Symbols to insert.
+ *
+ * @param SYMBOLS Codes of the symbols to insert.
  */
-void Tape::InsertSymbols(const std::vector<Symbol>& SYMBOLS) {
+void Tape::InsertSymbols(const std::vector<SymbolCode>& SYMBOLS) {
   Reset();
-  symbols.insert(symbols.begin() + head, SYMBOLS.begin(), SYMBOLS.end());
+  cells.resize(cellBits == 16 ? 2 * (head + SYMBOLS.size() + 2) : ((head + SYMBOLS.size() + 1) >> shift) + 1, 0);
+  for (std::uint64_t i{0}; i < SYMBOLS.size(); ++i) {
+    SetCell(head + i, SYMBOLS[i]);
+  }
+  rightmost = head + std::max<std::uint64_t>(SYMBOLS.size(), 1) - 1;
+}
+
+/**
+ * @brief Returns the number of bits of a cell of the tape.
+ *
+ * @return 1, 2, 8 or 16.
+ */
+unsigned Tape::CellBits() const {
+  return cellBits;
+}
+
+/**
+ * @brief Returns the extent of the tape: the number of cells between the leftmost and the rightmost cells visited by
+ *        the head or holding the input, both included.
+ *
+ * @return The extent of the tape in cells.
+ */
+std::uint64_t Tape::Extent() const {
+  return rightmost - leftmost + 1;
+}
+
+/**
+ * @brief Returns the memory used by the cells of the tape in the current run. The buffer kept from earlier runs is not
+ *        charged, so the usage only depends on the current input.
+ *
+ * @return The memory used by the tape in bytes.
+ */
+std::uint64_t Tape::MemoryUsage() const {
+  return cells.size();
+}
+
+/**
+ * @brief Returns the position of the head relative to the first cell of the input, which does not change when the
+ *        tape grows.
+ *
+ * @return The position of the head.
+ */
+std::int64_t Tape::Position() const {
+  return static_cast<std::int64_t>(head - origin);
+}
+
+/**
+ * @brief Returns the position of the leftmost cell visited by the head or holding the input.
+ *
+ * @return The position relative to the first cell of the input.
+ */
+std::int64_t Tape::Leftmost() const {
+  return static_cast<std::int64_t>(leftmost - origin);
+}
+
+/**
+ * @brief Returns the position of the rightmost cell visited by the head or holding the input. Every cell beyond the
+ *        leftmost and the rightmost ones is blank.
+ *
+ * @return The position relative to the first cell of the input.
+ */
+std::int64_t Tape::Rightmost() const {
+  return static_cast<std::int64_t>(rightmost - origin);
+}
+
+/**
+ * @brief Returns the symbol at a position of the tape, which is blank outside the allocated cells.
+ *
+ * @param POSITION Position relative to the first cell of the input.
+ * @return The code of the symbol at that position.
+ */
+SymbolCode Tape::At(const std::int64_t POSITION) const {
+  const std::int64_t INDEX{POSITION + static_cast<std::int64_t>(origin)};
+  return INDEX >= 0 && INDEX < static_cast<std::int64_t>(Size()) ? Cell(INDEX) : 0;
+}
+
+/**
+ * @brief Checks if two tapes hold the same configuration: the same symbols at the same positions and the head at the
+ *        same position, regardless of how many blank cells each one has allocated or visited.
+ *
+ * @param OTHER Tape to compare with.
+ * @return true If both tapes hold the same configuration.
+ * @return false Otherwise.
+ */
+bool Tape::operator==(const Tape& OTHER) const {
+  if (Position() != OTHER.Position()) {
+    return false;
+  }
+  const std::int64_t FIRST{std::min(Leftmost(), OTHER.Leftmost())};
+  const std::int64_t LAST{std::max(Rightmost(), OTHER.Rightmost())};
+  for (std::int64_t position{FIRST}; position <= LAST; ++position) {
+    if (At(position) != OTHER.At(position)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the code stored in a cell.
+ */
+SymbolCode Tape::Cell(const std::uint64_t INDEX) const {
+  if (cellBits == 16) {
+    SymbolCode symbol;
+    std::memcpy(&symbol, cells.data() + 2 * INDEX, sizeof(symbol));
+    return symbol;
+  }
+  return (cells[INDEX >> shift] >> ((INDEX & ((1u << shift) - 1)) * cellBits)) & ((1u << cellBits) - 1);
+}
+
+/**
+ * @brief Stores a code in a cell, keeping the other cells of its byte.
+ */
+void Tape::SetCell(const std::uint64_t INDEX, const SymbolCode SYMBOL) {
+  if (cellBits == 16) {
+    std::memcpy(cells.data() + 2 * INDEX, &SYMBOL, sizeof(SYMBOL));
+    return;
+  }
+  const unsigned OFFSET{static_cast<unsigned>(INDEX & ((1u << shift) - 1)) * cellBits};
+  std::uint8_t& byte{cells[INDEX >> shift]};
+  byte = (byte & ~(((1u << cellBits) - 1) << OFFSET)) | (SYMBOL << OFFSET);
+}
+
+/**
+ * @brief Returns the number of cells allocated.
+ */
+std::uint64_t Tape::Size() const {
+  return CellsIn(cells.size());
+}
+
+/**
+ * @brief Returns the number of cells held by a number of bytes.
+ */
+std::uint64_t Tape::CellsIn(const std::uint64_t BYTES) const {
+  return cellBits == 16 ? BYTES / 2 : BYTES << shift;
+}
+
+/**
+ * @brief Measures the span of Scan on a tape of packed or 16-bit cells, cell by cell. On packed cells, when the set
+ *        has a single symbol, the bytes made only of that symbol are skipped whole with the vectorized byte scan.
+ *
+ * @param SYMBOLS Codes of the symbols of the set.
+ * @param MOVEMENT Direction of the movements.
+ * @param LENGTH Maximum number of movements.
+ * @return The number of movements that Scan makes.
+ */
+std::uint64_t Tape::ScanCells(const std::vector<SymbolCode>& SYMBOLS, const Movement& MOVEMENT, const std::uint64_t LENGTH) const {
+  unsigned inSet{0};
+  std::uint8_t uniform{0};
+  if (cellBits < 8) {
+    for (const auto& SYMBOL : SYMBOLS) {
+      inSet |= 1u << SYMBOL;
+    }
+    for (unsigned i{0}; i < 8u; i += cellBits) {
+      uniform |= SYMBOLS.front() << i;
+    }
+  }
+  const std::uint64_t LOW_MASK{(1u << shift) - 1};
+  const bool SKIP_BYTES{cellBits < 8 && SYMBOLS.size() == 1};
+  const bool RIGHT{MOVEMENT == Movement::RIGHT};
+  std::uint64_t span{0};
+  while (span < LENGTH) {
+    const std::uint64_t INDEX{RIGHT ? head + span : head - span};
+    if (SKIP_BYTES && (INDEX & LOW_MASK) == (RIGHT ? 0 : LOW_MASK) && LENGTH - span > LOW_MASK) {
+      const std::size_t BYTES{(LENGTH - span) >> shift};
+      const std::size_t SKIPPED{RIGHT ? SpanForward(cells.data() + (INDEX >> shift), BYTES, &uniform, 1)
+                                      : SpanBackward(cells.data() + (INDEX >> shift) - BYTES + 1, BYTES, &uniform, 1)};
+      span += SKIPPED << shift;
+      if (SKIPPED == BYTES) {
+        continue;
+      }
+    }
+    const SymbolCode SYMBOL{Cell(RIGHT ? head + span : head - span)};
+    if (cellBits < 8 ? (inSet >> SYMBOL & 1) == 0 : std::find(SYMBOLS.begin(), SYMBOLS.end(), SYMBOL) == SYMBOLS.end()) {
+      break;
+    }
+    ++span;
+  }
+  return span;
+}
+
+/**
+ * @brief Prepends as many blank bytes as the tape already has (at least MIN_GROWTH), keeping the head and the
+ *        visited extents on the same cells.
+ */
+void Tape::GrowLeft() {
+  const std::uint64_t GROWTH{std::max<std::uint64_t>(cells.size(), MIN_GROWTH)};
+  cells.insert(cells.begin(), GROWTH, 0);
+  head += CellsIn(GROWTH);
+  leftmost += CellsIn(GROWTH);
+  rightmost += CellsIn(GROWTH);
+  origin += CellsIn(GROWTH);
+}
+
+/**
+ * @brief Appends as many blank bytes as the tape already has (at least MIN_GROWTH).
+ */
+void Tape::GrowRight() {
+  cells.resize(cells.size() + std::max<std::uint64_t>(cells.size(), MIN_GROWTH), 0);
 }
 
 /**
  * @brief Returns a string representation of the tape.
- * 
+ *
+ * @param SYMBOLS Symbol table that decodes the cells.
  * @return A string representation of the tape.
  */
-const std::string Tape::ToString() const {
-  int contentStart{-1}, contentEnd;
-  for (unsigned i{0}; i < symbols.size(); ++i) {
-    if (contentStart == -1 && (symbols[i] != blankSymbol || i == head)) {
-      contentStart = i - 1;
-    }
-    if (symbols[i] != blankSymbol || i == head) {
-      contentEnd = i + 1;
+const std::string Tape::ToString(const SymbolTable& SYMBOLS) const {
+  std::uint64_t contentStart{head - 1}, contentEnd{head + 1};
+  for (std::uint64_t i{0}; i < Size(); ++i) {
+    if (Cell(i) != 0) {
+      contentStart = std::min(contentStart, i - 1);
+      contentEnd = std::max(contentEnd, i + 1);
     }
   }
-  const std::vector<Symbol> CONTENT_SYMBOLS{symbols.begin() + contentStart, symbols.begin() + contentEnd + 1};
-  unsigned newHead{head - contentStart};
   std::string result;
-  for (unsigned i{0}; i < CONTENT_SYMBOLS.size(); ++i) {
-    if (i == newHead) {
+  for (std::uint64_t i{contentStart}; i <= contentEnd; ++i) {
+    if (i == head) {
       result += ">";
     }
-    result += CONTENT_SYMBOLS[i].ToString();
-    if (i == newHead) {
+    result += SYMBOLS.Decode(i < Size() ? Cell(i) : 0).ToString();
+    if (i == head) {
       result += "<";
     }
     result += " ";
   }
   return result;
-}
\ No newline at end of file
+}
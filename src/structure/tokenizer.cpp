@@ -0,0 +1,79 @@
+/**
+ * @file tokenizer.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to split input strings into the codes of their symbols.
+ * @date 17/10/2026
+ */
+
+#include <numeric>
+#include <stdexcept>
+
+#include "../../include/structure/tokenizer.hpp"
+
+/**
+ * @brief Constructs a new Tokenizer object.
+ *
+ * @param ALPHABET Input alphabet of the DTM.
+ * @param SYMBOLS Symbol table of the tape alphabet, which contains the input alphabet.
+ * @param SEPARATOR Separator of the symbols of an input string, or an empty string to split it per character.
+ */
+Tokenizer::Tokenizer(const Alphabet& ALPHABET, const SymbolTable& SYMBOLS, const std::string& SEPARATOR) : separator{SEPARATOR},
+                     alphabetString{std::accumulate(ALPHABET.begin(), ALPHABET.end(), std::string{}, [](const std::string& ACCOUNT, const Symbol& SYMBOL) { return ACCOUNT + SYMBOL.ToString() + " "; })} {
+  characterCodes.fill(-1);
+  std::vector<std::string> values;
+  for (const auto& SYMBOL : ALPHABET) {
+    if (SYMBOL.Value().length() == 1) {
+      characterCodes[static_cast<unsigned char>(SYMBOL.Value()[0])] = SYMBOLS.Code(SYMBOL);
+    }
+    values.emplace_back(SYMBOL.Value());
+  }
+  tokens = std::make_shared<const std::vector<std::string>>(std::move(values));
+  for (const auto& TOKEN : *tokens) {
+    tokenCodes.emplace(TOKEN, SYMBOLS.Code(Symbol{TOKEN}));
+  }
+}
+
+/**
+ * @brief Splits an input string into symbols and interns them.
+ *
+ * @param INPUT Input string to split.
+ * @param codes Vector where the codes of the symbols are stored. Its previous content is discarded.
+ * @throw std::invalid_argument If the input string contains symbols not found in the alphabet.
+ */
+void Tokenizer::Tokenize(const std::string_view INPUT, std::vector<SymbolCode>& codes) const {
+  codes.clear();
+  if (separator.empty()) {
+    for (std::size_t i{0}; i < INPUT.length(); ++i) {
+      if (INPUT[i] == Symbol::EPSILON.Value()[0]) {
+        continue;
+      }
+      const int CODE{characterCodes[static_cast<unsigned char>(INPUT[i])]};
+      if (CODE == -1) {
+        Reject(INPUT.substr(i, 1));
+      }
+      codes.emplace_back(CODE);
+    }
+    return;
+  }
+  std::size_t start{0};
+  while (start <= INPUT.length()) {
+    const std::size_t END{std::min(INPUT.find(separator, start), INPUT.length())};
+    const std::string_view TOKEN{INPUT.substr(start, END - start)};
+    start = END + separator.length();
+    if (TOKEN.empty() || TOKEN == Symbol::EPSILON.Value()) {
+      continue;
+    }
+    const auto CODE{tokenCodes.find(TOKEN)};
+    if (CODE == tokenCodes.end()) {
+      Reject(TOKEN);
+    }
+    codes.emplace_back(CODE->second);
+  }
+}
+
+/**
+ * @brief Throws the error of a symbol not found in the alphabet.
+ */
+void Tokenizer::Reject(const std::string_view TOKEN) const {
+  throw std::invalid_argument{"Runtime error: Input symbol: '" + std::string{TOKEN} + "' not found in alphabet ( " + alphabetString + ")"};
+}
@@ -0,0 +1,136 @@
+/**
+ * @file transitionTable.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to store the transitions of a DTM in a compressed sparse row layout.
+ * @date 17/10/2026
+ */
+
+#include <algorithm>
+
+#include "../../include/structure/transitionTable.hpp"
+
+/**
+ * @brief Constructs a new TransitionTable object without transitions.
+ *
+ * @param NUMBER_OF_TAPES Number of tapes of the DTM.
+ */
+TransitionTable::TransitionTable(const unsigned NUMBER_OF_TAPES) : numberOfTapes{NUMBER_OF_TAPES} {}
+
+/**
+ * @brief Appends a transition. It can only be looked up once the table is compressed.
+ *
+ * @param FROM_STATE Id of the state the transition belongs to.
+ * @param READ_SYMBOLS Codes of the symbols to read, one per tape.
+ * @param WRITE_SYMBOLS Codes of the symbols to write, one per tape.
+ * @param MOVEMENTS Movements to make, one per tape.
+ * @param TO_STATE Id of the state to transition to.
+ */
+void TransitionTable::Add(const StateId FROM_STATE, const std::vector<SymbolCode>& READ_SYMBOLS, const std::vector<SymbolCode>& WRITE_SYMBOLS, const std::vector<Movement>& MOVEMENTS, const StateId TO_STATE) {
+  fromStates.emplace_back(FROM_STATE);
+  readSymbols.insert(readSymbols.end(), READ_SYMBOLS.begin(), READ_SYMBOLS.end());
+  writeSymbols.insert(writeSymbols.end(), WRITE_SYMBOLS.begin(), WRITE_SYMBOLS.end());
+  movements.insert(movements.end(), MOVEMENTS.begin(), MOVEMENTS.end());
+  nextStates.emplace_back(TO_STATE);
+}
+
+/**
+ * @brief Groups the transitions added by the state they belong to with a counting sort, which is stable, and builds
+ *        the offsets of the states.
+ *
+ * @param NUMBER_OF_STATES Number of states of the DTM.
+ */
+void TransitionTable::Compress(const unsigned NUMBER_OF_STATES) {
+  offsets.assign(NUMBER_OF_STATES + 1, 0);
+  for (const auto& STATE : fromStates) {
+    ++offsets[STATE + 1];
+  }
+  for (unsigned i{0}; i < NUMBER_OF_STATES; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+  std::vector<unsigned> next{offsets.begin(), offsets.end() - 1};
+  std::vector<SymbolCode> sortedReads(readSymbols.size()), sortedWrites(writeSymbols.size());
+  std::vector<Movement> sortedMovements(movements.size());
+  std::vector<StateId> sortedNextStates(nextStates.size());
+  for (unsigned i{0}; i < fromStates.size(); ++i) {
+    const unsigned TO{next[fromStates[i]]++};
+    std::copy_n(readSymbols.begin() + i * numberOfTapes, numberOfTapes, sortedReads.begin() + TO * numberOfTapes);
+    std::copy_n(writeSymbols.begin() + i * numberOfTapes, numberOfTapes, sortedWrites.begin() + TO * numberOfTapes);
+    std::copy_n(movements.begin() + i * numberOfTapes, numberOfTapes, sortedMovements.begin() + TO * numberOfTapes);
+    sortedNextStates[TO] = nextStates[i];
+  }
+  readSymbols.swap(sortedReads);
+  writeSymbols.swap(sortedWrites);
+  movements.swap(sortedMovements);
+  nextStates.swap(sortedNextStates);
+  fromStates.clear();
+  fromStates.shrink_to_fit();
+}
+
+/**
+ * @brief Returns the index of the first transition of a state.
+ *
+ * @param STATE Id of the state.
+ * @return The index of its first transition.
+ */
+unsigned TransitionTable::Begin(const StateId STATE) const {
+  return offsets[STATE];
+}
+
+/**
+ * @brief Returns the index past the last transition of a state.
+ *
+ * @param STATE Id of the state.
+ * @return The index past its last transition.
+ */
+unsigned TransitionTable::End(const StateId STATE) const {
+  return offsets[STATE + 1];
+}
+
+/**
+ * @brief Returns the codes of the symbols read by a transition.
+ *
+ * @param INDEX Index of the transition.
+ * @return A pointer to NUMBER_OF_TAPES codes.
+ */
+const SymbolCode* TransitionTable::ReadSymbols(const unsigned INDEX) const {
+  return readSymbols.data() + INDEX * numberOfTapes;
+}
+
+/**
+ * @brief Returns the codes of the symbols written by a transition.
+ *
+ * @param INDEX Index of the transition.
+ * @return A pointer to NUMBER_OF_TAPES codes.
+ */
+const SymbolCode* TransitionTable::WriteSymbols(const unsigned INDEX) const {
+  return writeSymbols.data() + INDEX * numberOfTapes;
+}
+
+/**
+ * @brief Returns the movements made by a transition.
+ *
+ * @param INDEX Index of the transition.
+ * @return A pointer to NUMBER_OF_TAPES movements.
+ */
+const Movement* TransitionTable::Movements(const unsigned INDEX) const {
+  return movements.data() + INDEX * numberOfTapes;
+}
+
+/**
+ * @brief Returns the next state of a transition.
+ *
+ * @param INDEX Index of the transition.
+ * @return The id of the state to transition to.
+ */
+StateId TransitionTable::NextState(const unsigned INDEX) const {
+  return nextStates[INDEX];
+}
+
+/**
+ * @brief Returns the number of transitions.
+ *
+ * @return The number of transitions.
+ */
+unsigned TransitionTable::Size() const {
+  return nextStates.size();
+}
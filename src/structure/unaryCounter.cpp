@@ -0,0 +1,256 @@
+/**
+ * @file unaryCounter.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to represent a DTM tape used as a unary counter.
+ * @date 17/10/2026
+ */
+
+#include "../../include/structure/unaryCounter.hpp"
+
+/**
+ * @brief Constructs a new UnaryCounter object: a blank tape, with a count of 0.
+ */
+UnaryCounter::UnaryCounter() {
+  Reset();
+}
+
+/**
+ * @brief Resets the counter to a blank tape with the head on its first cell.
+ */
+void UnaryCounter::Reset() {
+  marker = 0;
+  first = 0;
+  count = 0;
+  head = 0;
+  leftmost = 0;
+  rightmost = 0;
+}
+
+/**
+ * @brief Reads the symbol in the current position of the tape.
+ *
+ * @return The marker if the head is on the block, or the blank symbol otherwise.
+ */
+SymbolCode UnaryCounter::Read() const {
+  return head >= first && head < first + static_cast<std::int64_t>(count) ? marker : 0;
+}
+
+/**
+ * @brief Writes a symbol in the current position of the tape. The marker next to the block (or anywhere, if the count
+ *        is 0) increments the counter, and blank on an end of the block decrements it.
+ *
+ * @param SYMBOL Code of the symbol to write.
+ */
+void UnaryCounter::Write(const SymbolCode SYMBOL) {
+  const std::int64_t END{first + static_cast<std::int64_t>(count)};
+  if (SYMBOL == 0) {
+    if (count > 0 && head == END - 1) {
+      --count;
+    } else if (count > 0 && head == first) {
+      ++first;
+      --count;
+    }
+    return;
+  }
+  marker = SYMBOL;
+  if (count == 0) {
+    first = head;
+    count = 1;
+  } else if (head == END) {
+    ++count;
+  } else if (head == first - 1) {
+    --first;
+    ++count;
+  }
+}
+
+/**
+ * @brief Moves the head of the tape to the left, right or stays in the same position.
+ *
+ * @param MOVEMENT Movement to perform.
+ */
+void UnaryCounter::MoveHead(const Movement& MOVEMENT) {
+  Jump(MOVEMENT, 1);
+}
+
+/**
+ * @brief Moves the head over the cells holding symbols of a set, as Tape::Scan does, in constant time. As the tape
+ *        beyond the block is blank, the head only stops on a cell outside the set or after MAX_CELLS movements.
+ *
+ * @param SYMBOLS Codes of the symbols of the set.
+ * @param MOVEMENT Direction of the movements.
+ * @param MAX_CELLS Maximum number of movements.
+ * @return The number of movements made.
+ */
+std::uint64_t UnaryCounter::Scan(const std::vector<SymbolCode>& SYMBOLS, const Movement& MOVEMENT, const std::uint64_t MAX_CELLS) {
+  std::array<SymbolRun, 3> runs;
+  const unsigned NUMBER_OF_RUNS{Runs(MOVEMENT, MAX_CELLS, runs)};
+  std::uint64_t span{0};
+  for (unsigned i{0}; i < NUMBER_OF_RUNS && std::find(SYMBOLS.begin(), SYMBOLS.end(), runs[i].symbol) != SYMBOLS.end(); ++i) {
+    span += runs[i].length;
+  }
+  Jump(MOVEMENT, span);
+  return span;
+}
+
+/**
+ * @brief Counts the cells from the head, in a direction, that match a periodic pattern, as Tape::Match does. Each run
+ *        of equal cells is checked against a single period of the pattern, so the time does not depend on the count.
+ *
+ * @param PATTERN Codes of the symbols of a period of the pattern, SymbolTable::ANY matching any symbol.
+ * @param MOVEMENT Direction of the cells.
+ * @param MAX_CELLS Maximum number of cells.
+ * @return The number of cells matched.
+ */
+std::uint64_t UnaryCounter::Match(const std::vector<SymbolCode>& PATTERN, const Movement& MOVEMENT, const std::uint64_t MAX_CELLS) const {
+  std::array<SymbolRun, 3> runs;
+  const unsigned NUMBER_OF_RUNS{Runs(MOVEMENT, MAX_CELLS, runs)};
+  std::uint64_t matched{0};
+  for (unsigned i{0}; i < NUMBER_OF_RUNS; ++i) {
+    const std::uint64_t CHECKED{std::min<std::uint64_t>(runs[i].length, PATTERN.size())};
+    for (std::uint64_t j{0}; j < CHECKED; ++j) {
+      const SymbolCode EXPECTED{PATTERN[(matched + j) % PATTERN.size()]};
+      if (EXPECTED != SymbolTable::ANY && EXPECTED != runs[i].symbol) {
+        return matched + j;
+      }
+    }
+    matched += runs[i].length;
+  }
+  return matched;
+}
+
+/**
+ * @brief Writes a periodic pattern over the cells from the head in a direction and moves the head past them, as
+ *        Tape::Fill does. A pattern of a single symbol is applied in constant time, as a single change of the block.
+ *
+ * @param PATTERN Codes of the symbols of a period of the pattern, SymbolTable::ANY keeping the cell.
+ * @param MOVEMENT Direction of the cells.
+ * @param CELLS Number of cells to write.
+ */
+void UnaryCounter::Fill(const std::vector<SymbolCode>& PATTERN, const Movement& MOVEMENT, const std::uint64_t CELLS) {
+  if (MOVEMENT == Movement::STAY || CELLS == 0) {
+    return;
+  }
+  if (std::any_of(PATTERN.begin(), PATTERN.end(), [&PATTERN](const SymbolCode SYMBOL) { return SYMBOL != PATTERN.front(); })) {
+    for (std::uint64_t i{0}; i < CELLS; ++i) {
+      if (PATTERN[i % PATTERN.size()] != SymbolTable::ANY) {
+        Write(PATTERN[i % PATTERN.size()]);
+      }
+      MoveHead(MOVEMENT);
+    }
+    return;
+  }
+  const SymbolCode SYMBOL{PATTERN.front()};
+  const std::int64_t LOW{MOVEMENT == Movement::RIGHT ? head : head - static_cast<std::int64_t>(CELLS) + 1};
+  const std::int64_t HIGH{LOW + static_cast<std::int64_t>(CELLS)};
+  const std::int64_t END{first + static_cast<std::int64_t>(count)};
+  if (SYMBOL != 0 && SYMBOL != SymbolTable::ANY) {
+    marker = SYMBOL;
+    first = count == 0 ? LOW : std::min(first, LOW);
+    count = static_cast<std::uint64_t>((count == 0 ? HIGH : std::max(END, HIGH)) - first);
+  } else if (SYMBOL == 0 && count > 0 && LOW <= first && HIGH >= END) {
+    count = 0;
+  } else if (SYMBOL == 0 && count > 0 && LOW <= first && HIGH > first) {
+    count = static_cast<std::uint64_t>(END - HIGH);
+    first = HIGH;
+  } else if (SYMBOL == 0 && count > 0 && HIGH >= END && LOW < END) {
+    count = static_cast<std::uint64_t>(LOW - first);
+  }
+  Jump(MOVEMENT, CELLS);
+}
+
+/**
+ * @brief Returns the number of cells of the block.
+ *
+ * @return The value of the counter.
+ */
+std::uint64_t UnaryCounter::Count() const {
+  return count;
+}
+
+/**
+ * @brief Returns the extent of the tape: the number of cells between the leftmost and the rightmost cells visited by
+ *        the head, both included.
+ *
+ * @return The extent of the tape in cells.
+ */
+std::uint64_t UnaryCounter::Extent() const {
+  return static_cast<std::uint64_t>(rightmost - leftmost + 1);
+}
+
+/**
+ * @brief Returns the memory used by the counter, which does not depend on its count.
+ *
+ * @return The memory used by the counter in bytes.
+ */
+std::uint64_t UnaryCounter::MemoryUsage() const {
+  return sizeof(UnaryCounter);
+}
+
+/**
+ * @brief Returns the position of the head relative to the first cell of the input.
+ *
+ * @return The position of the head.
+ */
+std::int64_t UnaryCounter::Position() const {
+  return head;
+}
+
+/**
+ * @brief Returns a string representation of the tape the counter stands for, as Tape::ToString does.
+ *
+ * @param SYMBOLS Symbol table that decodes the cells.
+ * @return A string representation of the tape.
+ */
+const std::string UnaryCounter::ToString(const SymbolTable& SYMBOLS) const {
+  return RunLengthTape::Format(count == 0 ? std::vector<SymbolRun>{} : std::vector<SymbolRun>{SymbolRun{marker, count}}, first, head, SYMBOLS);
+}
+
+/**
+ * @brief Splits the cells from the head in a direction into runs of equal cells: at most a run of blank cells before
+ *        the block, one inside it and the blank cells after it, which fill the runs up to MAX_CELLS cells.
+ *
+ * @param MOVEMENT Direction of the cells.
+ * @param MAX_CELLS Number of cells to split.
+ * @param runs Runs of the cells, from the head on.
+ * @return The number of runs.
+ */
+unsigned UnaryCounter::Runs(const Movement& MOVEMENT, const std::uint64_t MAX_CELLS, std::array<SymbolRun, 3>& runs) const {
+  if (MOVEMENT == Movement::STAY) {
+    return 0;
+  }
+  const bool RIGHT{MOVEMENT == Movement::RIGHT};
+  const std::int64_t NEAR{RIGHT ? first : first + static_cast<std::int64_t>(count) - 1};
+  const std::int64_t DISTANCE{RIGHT ? NEAR - head : head - NEAR};
+  std::uint64_t left{MAX_CELLS};
+  unsigned number{0};
+  const auto PUSH{[&](const SymbolCode SYMBOL, const std::uint64_t LENGTH) {
+    if (left > 0 && LENGTH > 0) {
+      runs[number++] = SymbolRun{SYMBOL, std::min(LENGTH, left)};
+      left -= runs[number - 1].length;
+    }
+  }};
+  if (count > 0 && DISTANCE > -static_cast<std::int64_t>(count)) {
+    const std::uint64_t BEFORE{static_cast<std::uint64_t>(std::max<std::int64_t>(DISTANCE, 0))};
+    PUSH(0, BEFORE);
+    PUSH(marker, static_cast<std::uint64_t>(std::min<std::int64_t>(static_cast<std::int64_t>(count), static_cast<std::int64_t>(count) + DISTANCE)));
+  }
+  PUSH(0, left);
+  return number;
+}
+
+/**
+ * @brief Moves the head a number of cells in a direction, updating the visited extents.
+ *
+ * @param MOVEMENT Direction of the movement.
+ * @param CELLS Number of cells to move.
+ */
+void UnaryCounter::Jump(const Movement& MOVEMENT, const std::uint64_t CELLS) {
+  if (MOVEMENT == Movement::RIGHT) {
+    head += static_cast<std::int64_t>(CELLS);
+    rightmost = std::max(rightmost, head);
+  } else if (MOVEMENT == Movement::LEFT) {
+    head -= static_cast<std::int64_t>(CELLS);
+    leftmost = std::min(leftmost, head);
+  }
+}
@@ -0,0 +1,156 @@
+/**
+ * @file byteScan.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the vectorized functions to measure spans of bytes belonging to a set.
+ * @date 17/10/2026
+ */
+
+#include <array>
+
+#include "../../include/utils/byteScan.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BYTE_SCAN_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Maximum size of the sets compared with vector instructions. Larger sets use a lookup table.
+ */
+static const std::size_t MAX_VECTOR_SET{8};
+
+/**
+ * @brief Scalar version of SpanForward, based on a lookup table.
+ */
+static std::size_t ScalarSpanForward(const unsigned char* DATA, const std::size_t LENGTH, const unsigned char* SET, const std::size_t SET_SIZE) {
+  std::array<bool, 256> inSet{};
+  for (std::size_t i{0}; i < SET_SIZE; ++i) {
+    inSet[SET[i]] = true;
+  }
+  std::size_t span{0};
+  while (span < LENGTH && inSet[DATA[span]]) {
+    ++span;
+  }
+  return span;
+}
+
+/**
+ * @brief Scalar version of SpanBackward, based on a lookup table.
+ */
+static std::size_t ScalarSpanBackward(const unsigned char* DATA, const std::size_t LENGTH, const unsigned char* SET, const std::size_t SET_SIZE) {
+  std::array<bool, 256> inSet{};
+  for (std::size_t i{0}; i < SET_SIZE; ++i) {
+    inSet[SET[i]] = true;
+  }
+  std::size_t span{0};
+  while (span < LENGTH && inSet[DATA[LENGTH - span - 1]]) {
+    ++span;
+  }
+  return span;
+}
+
+#ifdef BYTE_SCAN_X86
+
+/**
+ * @brief Returns a mask with a bit set for each of the 16 bytes of a block that belongs to a set.
+ */
+__attribute__((target("sse2"))) static unsigned Mask16(const unsigned char* BLOCK, const unsigned char* SET, const std::size_t SET_SIZE) {
+  const __m128i VALUES{_mm_loadu_si128(reinterpret_cast<const __m128i*>(BLOCK))};
+  __m128i matches{_mm_setzero_si128()};
+  for (std::size_t i{0}; i < SET_SIZE; ++i) {
+    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(VALUES, _mm_set1_epi8(static_cast<char>(SET[i]))));
+  }
+  return static_cast<unsigned>(_mm_movemask_epi8(matches));
+}
+
+/**
+ * @brief Returns a mask with a bit set for each of the 32 bytes of a block that belongs to a set.
+ */
+__attribute__((target("avx2"))) static unsigned Mask32(const unsigned char* BLOCK, const unsigned char* SET, const std::size_t SET_SIZE) {
+  const __m256i VALUES{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(BLOCK))};
+  __m256i matches{_mm256_setzero_si256()};
+  for (std::size_t i{0}; i < SET_SIZE; ++i) {
+    matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(VALUES, _mm256_set1_epi8(static_cast<char>(SET[i]))));
+  }
+  return static_cast<unsigned>(_mm256_movemask_epi8(matches));
+}
+
+/**
+ * @brief Vectorized version of SpanForward, 16 or 32 bytes per iteration.
+ */
+template <std::size_t WIDTH>
+static std::size_t VectorSpanForward(const unsigned char* DATA, const std::size_t LENGTH, const unsigned char* SET, const std::size_t SET_SIZE) {
+  const unsigned FULL{WIDTH == 32 ? 0xFFFFFFFFu : 0xFFFFu};
+  std::size_t span{0};
+  for (; span + WIDTH <= LENGTH; span += WIDTH) {
+    const unsigned MASK{WIDTH == 32 ? Mask32(DATA + span, SET, SET_SIZE) : Mask16(DATA + span, SET, SET_SIZE)};
+    if (MASK != FULL) {
+      return span + __builtin_ctz(~MASK & FULL);
+    }
+  }
+  return span + ScalarSpanForward(DATA + span, LENGTH - span, SET, SET_SIZE);
+}
+
+/**
+ * @brief Vectorized version of SpanBackward, 16 or 32 bytes per iteration.
+ */
+template <std::size_t WIDTH>
+static std::size_t VectorSpanBackward(const unsigned char* DATA, const std::size_t LENGTH, const unsigned char* SET, const std::size_t SET_SIZE) {
+  const unsigned FULL{WIDTH == 32 ? 0xFFFFFFFFu : 0xFFFFu};
+  std::size_t span{0};
+  for (; span + WIDTH <= LENGTH; span += WIDTH) {
+    const unsigned MASK{WIDTH == 32 ? Mask32(DATA + LENGTH - span - WIDTH, SET, SET_SIZE) : Mask16(DATA + LENGTH - span - WIDTH, SET, SET_SIZE)};
+    if (MASK != FULL) {
+      return span + (WIDTH - 1) - (31 - __builtin_clz(~MASK & FULL));
+    }
+  }
+  return span + ScalarSpanBackward(DATA, LENGTH - span, SET, SET_SIZE);
+}
+
+/**
+ * @brief Checks once if the processor supports AVX2.
+ */
+static bool HasAVX2() {
+  static const bool HAS_AVX2{__builtin_cpu_supports("avx2") != 0};
+  return HAS_AVX2;
+}
+
+#endif
+
+/**
+ * @brief Returns the number of leading bytes of a buffer that belong to a set. Uses AVX2 or SSE2 when available and
+ *        falls back to a scalar loop otherwise.
+ *
+ * @param DATA Buffer to scan.
+ * @param LENGTH Length of the buffer.
+ * @param SET Bytes of the set.
+ * @param SET_SIZE Number of bytes of the set.
+ * @return The length of the longest prefix of the buffer made of bytes of the set.
+ */
+std::size_t SpanForward(const unsigned char* DATA, const std::size_t LENGTH, const unsigned char* SET, const std::size_t SET_SIZE) {
+#ifdef BYTE_SCAN_X86
+  if (SET_SIZE <= MAX_VECTOR_SET) {
+    return HasAVX2() ? VectorSpanForward<32>(DATA, LENGTH, SET, SET_SIZE) : VectorSpanForward<16>(DATA, LENGTH, SET, SET_SIZE);
+  }
+#endif
+  return ScalarSpanForward(DATA, LENGTH, SET, SET_SIZE);
+}
+
+/**
+ * @brief Returns the number of trailing bytes of a buffer that belong to a set. Uses AVX2 or SSE2 when available and
+ *        falls back to a scalar loop otherwise.
+ *
+ * @param DATA Buffer to scan.
+ * @param LENGTH Length of the buffer.
+ * @param SET Bytes of the set.
+ * @param SET_SIZE Number of bytes of the set.
+ * @return The length of the longest suffix of the buffer made of bytes of the set.
+ */
+std::size_t SpanBackward(const unsigned char* DATA, const std::size_t LENGTH, const unsigned char* SET, const std::size_t SET_SIZE) {
+#ifdef BYTE_SCAN_X86
+  if (SET_SIZE <= MAX_VECTOR_SET) {
+    return HasAVX2() ? VectorSpanBackward<32>(DATA, LENGTH, SET, SET_SIZE) : VectorSpanBackward<16>(DATA, LENGTH, SET, SET_SIZE);
+  }
+#endif
+  return ScalarSpanBackward(DATA, LENGTH, SET, SET_SIZE);
+}
@@ -0,0 +1,138 @@
+/**
+ * @file workStealingPool.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to run batches of independent tasks on a work-stealing thread pool.
+ * @date 17/10/2026
+ */
+
+#include "../../include/utils/workStealingPool.hpp"
+
+/**
+ * @brief Constructs a new WorkStealingPool object and starts its threads.
+ *
+ * @param THREADS Number of threads, or 0 to use one per hardware thread.
+ */
+WorkStealingPool::WorkStealingPool(const unsigned THREADS) : task{nullptr}, batch{0}, busy{0}, stopping{false} {
+  const unsigned SIZE{THREADS > 0 ? THREADS : std::max(1u, std::thread::hardware_concurrency())};
+  for (unsigned i{0}; i < SIZE; ++i) {
+    queues.emplace_back(std::make_unique<Queue>());
+  }
+  for (unsigned i{0}; i < SIZE; ++i) {
+    threads.emplace_back(&WorkStealingPool::Work, this, i);
+  }
+}
+
+/**
+ * @brief Returns the number of workers of the pool.
+ *
+ * @return The number of workers.
+ */
+unsigned WorkStealingPool::Size() const {
+  return threads.size();
+}
+
+/**
+ * @brief Runs a batch of tasks and waits for all of them to finish. If a task throws, the tasks not started yet are
+ *        dropped and the first exception is rethrown.
+ *
+ * @param ORDER Indexes of the tasks, in the order they should preferably start.
+ * @param TASK Function that runs a task.
+ */
+void WorkStealingPool::Run(const std::vector<std::size_t>& ORDER, const PoolTask& TASK) {
+  for (std::size_t i{0}; i < ORDER.size(); ++i) {
+    queues[i % queues.size()]->tasks.emplace_back(ORDER[i]);
+  }
+  std::unique_lock<std::mutex> lock{mutex};
+  task = &TASK;
+  error = nullptr;
+  busy = threads.size();
+  ++batch;
+  wakeUp.notify_all();
+  done.wait(lock, [this]() { return busy == 0; });
+  task = nullptr;
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+/**
+ * @brief Stops the threads of the pool.
+ */
+WorkStealingPool::~WorkStealingPool() {
+  {
+    const std::lock_guard<std::mutex> LOCK{mutex};
+    stopping = true;
+  }
+  wakeUp.notify_all();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+/**
+ * @brief Main loop of a worker: waits for a batch, runs tasks until there are none left and reports it is done.
+ *
+ * @param WORKER Index of the worker.
+ */
+void WorkStealingPool::Work(const unsigned WORKER) {
+  std::uint64_t lastBatch{0};
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock{mutex};
+      wakeUp.wait(lock, [this, lastBatch]() { return stopping || batch != lastBatch; });
+      if (stopping) {
+        return;
+      }
+      lastBatch = batch;
+    }
+    std::size_t index;
+    while (Next(WORKER, index)) {
+      try {
+        (*task)(WORKER, index);
+      } catch (...) {
+        const std::lock_guard<std::mutex> LOCK{mutex};
+        if (!error) {
+          error = std::current_exception();
+        }
+        for (auto& queue : queues) {
+          const std::lock_guard<std::mutex> QUEUE_LOCK{queue->mutex};
+          queue->tasks.clear();
+        }
+      }
+    }
+    const std::lock_guard<std::mutex> LOCK{mutex};
+    if (--busy == 0) {
+      done.notify_one();
+    }
+  }
+}
+
+/**
+ * @brief Takes the next task of a worker: the front of its own deque or, if it is empty, the back of another one.
+ *
+ * @param WORKER Index of the worker.
+ * @param index Index of the task taken.
+ * @return true If a task was taken.
+ * @return false If every deque is empty.
+ */
+bool WorkStealingPool::Next(const unsigned WORKER, std::size_t& index) {
+  {
+    Queue& own{*queues[WORKER]};
+    const std::lock_guard<std::mutex> LOCK{own.mutex};
+    if (!own.tasks.empty()) {
+      index = own.tasks.front();
+      own.tasks.pop_front();
+      return true;
+    }
+  }
+  for (unsigned i{1}; i < queues.size(); ++i) {
+    Queue& victim{*queues[(WORKER + i) % queues.size()]};
+    const std::lock_guard<std::mutex> LOCK{victim.mutex};
+    if (!victim.tasks.empty()) {
+      index = victim.tasks.back();
+      victim.tasks.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
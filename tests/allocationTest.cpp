@@ -0,0 +1,106 @@
+/**
+ * @file allocationTest.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Checks that the runs of a warmed up DTM do not allocate memory per step.
+ * @date 17/10/2026
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include "../include/input/DTMInput.hpp"
+
+/**
+ * @brief Number of calls to the global operator new since the start of the program.
+ */
+std::atomic<std::uint64_t> allocations{0};
+
+/**
+ * @brief Allocates memory, counting the allocation.
+ *
+ * @param SIZE Number of bytes to allocate.
+ * @return Pointer to the memory allocated.
+ * @throw std::bad_alloc If the memory cannot be allocated.
+ */
+void* operator new(const std::size_t SIZE) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  void* const MEMORY{std::malloc(SIZE == 0 ? 1 : SIZE)};
+  if (MEMORY == nullptr) {
+    throw std::bad_alloc{};
+  }
+  return MEMORY;
+}
+
+/**
+ * @brief Frees memory allocated by the global operator new.
+ *
+ * @param memory Pointer to the memory to free.
+ */
+void operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+/**
+ * @brief Frees memory allocated by the global operator new.
+ *
+ * @param memory Pointer to the memory to free.
+ */
+void operator delete(void* memory, const std::size_t) noexcept {
+  std::free(memory);
+}
+
+/**
+ * @brief Runs an input on a DTM and counts the allocations made by the run.
+ *
+ * @param dtm DTM to run.
+ * @param INPUT Input string to run.
+ * @param steps Number of steps made by the run.
+ * @return The number of allocations made by the run.
+ */
+std::uint64_t CountAllocations(DTM& dtm, const std::string& INPUT, std::uint64_t& steps) {
+  const std::uint64_t BEFORE{allocations.load()};
+  const RunResult RESULT{dtm.Run(INPUT, RunLimits{})};
+  const std::uint64_t AFTER{allocations.load()};
+  steps = RESULT.steps;
+  return AFTER - BEFORE;
+}
+
+/**
+ * @brief Machine the test runs, which reverses strings of a and b, so the number of steps grows with the input.
+ */
+const std::string MACHINE_FILE_NAME{"examples/mt3.json"};
+
+/**
+ * @brief Main function which runs the test: after a warm-up run, a short input and an input that makes many more steps
+ *        must allocate the same number of times, at most once per tape (the extents of the result), on every engine
+ *        that runs on flat tapes.
+ * @return 0 if the test passes, 1 otherwise.
+ */
+int main() {
+  DTM dtm{DTMInput::ReadDTM(MACHINE_FILE_NAME)};
+  const unsigned NUMBER_OF_TAPES{static_cast<unsigned>(dtm.Machine()->NewWorkspace().context.tapes.size())};
+  const std::string SHORT_INPUT{"ab"};
+  const std::string LONG_INPUT{[]() {
+    std::string input;
+    for (unsigned i{0}; i < 100000; ++i) {
+      input += i % 3 == 0 ? 'b' : 'a';
+    }
+    return input;
+  }()};
+  bool passed{true};
+  for (const std::pair<EngineKind, std::string>& ENGINE : {std::pair<EngineKind, std::string>{EngineKind::SPECIALIZED, "specialized"}, {EngineKind::THREADED, "threaded"}, {EngineKind::JIT, "jit"}}) {
+    dtm.SetEngine(ENGINE.first);
+    std::uint64_t shortSteps{0};
+    std::uint64_t longSteps{0};
+    CountAllocations(dtm, LONG_INPUT, longSteps);
+    const std::uint64_t SHORT_ALLOCATIONS{CountAllocations(dtm, SHORT_INPUT, shortSteps)};
+    const std::uint64_t LONG_ALLOCATIONS{CountAllocations(dtm, LONG_INPUT, longSteps)};
+    const bool ENGINE_PASSED{SHORT_ALLOCATIONS == LONG_ALLOCATIONS && LONG_ALLOCATIONS <= NUMBER_OF_TAPES};
+    std::cout << (ENGINE_PASSED ? "PASS" : "FAIL") << " engine " << ENGINE.second << ": " << SHORT_ALLOCATIONS << " allocations in " << shortSteps << " steps, "
+              << LONG_ALLOCATIONS << " allocations in " << longSteps << " steps (at most " << NUMBER_OF_TAPES << " per run)\n";
+    passed = passed && ENGINE_PASSED;
+  }
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
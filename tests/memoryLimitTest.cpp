@@ -0,0 +1,65 @@
+/**
+ * @file memoryLimitTest.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Checks that the memory budget of a DTM run does not depend on the runs made before it.
+ * @date 17/10/2026
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "../include/input/DTMInput.hpp"
+
+/**
+ * @brief Machine the test runs, which doubles unary numbers in a time quadratic in the input, so even small inputs
+ *        reach a check of the budgets.
+ */
+const std::string MACHINE_FILE_NAME{"examples/av2.json"};
+
+/**
+ * @brief Machine the Hashlife engine runs, which sweeps its input forever. Its memoized sweeps make each check of the
+ *        budgets cover many steps, so the large input is checked against the step budget instead.
+ */
+const std::string SWEEP_MACHINE_FILE_NAME{"examples/av3.json"};
+
+/**
+ * @brief Main function which runs the test: under a tight memory budget, a large input must exhaust it and a small
+ *        input run right after it on the same workspace must still be accepted, on every engine whose tapes grow with
+ *        the input. On the Hashlife engine, whose segments are kept between runs, a small input run right after an
+ *        irregular large one must end as it does on its own.
+ * @return 0 if the test passes, 1 otherwise.
+ */
+int main() {
+  DTM dtm{DTMInput::ReadDTM(MACHINE_FILE_NAME)};
+  RunLimits limits;
+  limits.maxMemory = 1000;
+  const std::string LARGE_INPUT(3000, '1');
+  const std::string SMALL_INPUT(200, '1');
+  bool passed{true};
+  for (const std::pair<EngineKind, std::string>& ENGINE : {std::pair<EngineKind, std::string>{EngineKind::SPECIALIZED, "specialized"}, {EngineKind::THREADED, "threaded"}, {EngineKind::JIT, "jit"}}) {
+    dtm.SetEngine(ENGINE.first);
+    const HaltReason LARGE_REASON{dtm.Run(LARGE_INPUT, limits).reason};
+    const HaltReason SMALL_REASON{dtm.Run(SMALL_INPUT, limits).reason};
+    const bool ENGINE_PASSED{LARGE_REASON == HaltReason::MEMORY_LIMIT && SMALL_REASON == HaltReason::ACCEPTED};
+    std::cout << (ENGINE_PASSED ? "PASS" : "FAIL") << " engine " << ENGINE.second << ": the large input " << (LARGE_REASON == HaltReason::MEMORY_LIMIT ? "exhausts" : "does not exhaust")
+              << " the memory budget, the small input after it is " << (SMALL_REASON == HaltReason::ACCEPTED ? "accepted" : "not accepted") << "\n";
+    passed = passed && ENGINE_PASSED;
+  }
+  DTM sweepDTM{DTMInput::ReadDTM(SWEEP_MACHINE_FILE_NAME)};
+  sweepDTM.SetEngine(EngineKind::HASHLIFE);
+  limits.maxSteps = 10000000;
+  std::mt19937 generator{0};
+  std::string irregularInput;
+  for (unsigned i{0}; i < LARGE_INPUT.size(); ++i) {
+    irregularInput += (generator() & 1) ? 'a' : 'b';
+  }
+  const HaltReason ALONE_REASON{sweepDTM.Run("ab", limits).reason};
+  sweepDTM.Run(irregularInput, limits);
+  const HaltReason AFTER_REASON{sweepDTM.Run("ab", limits).reason};
+  const bool HASHLIFE_PASSED{ALONE_REASON == HaltReason::STEP_LIMIT && AFTER_REASON == HaltReason::STEP_LIMIT};
+  std::cout << (HASHLIFE_PASSED ? "PASS" : "FAIL") << " engine hashlife: the small input " << (AFTER_REASON == ALONE_REASON ? "ends" : "does not end")
+            << " the same way after the large input as on its own\n";
+  passed = passed && HASHLIFE_PASSED;
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
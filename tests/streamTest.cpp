@@ -0,0 +1,71 @@
+/**
+ * @file streamTest.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Checks that a stream with inputs longer than a chunk gets the results of running each input on its own.
+ * @date 17/10/2026
+ */
+
+#include <cstdlib>
+#include <iostream>
+
+#include "../include/input/DTMInput.hpp"
+#include "../include/input/streamPipeline.hpp"
+
+/**
+ * @brief Machine the test runs, which reverses strings of a and b, so the number of steps depends on the whole input.
+ */
+const std::string MACHINE_FILE_NAME{"examples/mt3.json"};
+
+/**
+ * @brief Evaluates a stream with a pipeline and returns what it writes.
+ *
+ * @param dtm DTM that evaluates the inputs.
+ * @param OPTIONS Options of the stream.
+ * @param STREAM Bytes of the stream.
+ * @return The results written by the pipeline.
+ */
+std::string RunStream(DTM& dtm, const StreamOptions& OPTIONS, const std::string& STREAM) {
+  std::FILE* input{std::tmpfile()};
+  std::FILE* output{std::tmpfile()};
+  std::fwrite(STREAM.data(), 1, STREAM.size(), input);
+  std::rewind(input);
+  StreamPipeline{dtm, RunLimits{}, OPTIONS}.Run(input, output);
+  std::string results(std::ftell(output), '\0');
+  std::rewind(output);
+  results.resize(std::fread(&results[0], 1, results.size(), output));
+  std::fclose(input);
+  std::fclose(output);
+  return results;
+}
+
+/**
+ * @brief Main function which runs the test: a stream of short inputs and inputs spanning several chunks, the last one
+ *        without a line feed, must get, in both formats, the verdict and steps of running each input on its own.
+ * @return 0 if the test passes, 1 otherwise.
+ */
+int main() {
+  DTM dtm{DTMInput::ReadDTM(MACHINE_FILE_NAME)};
+  std::string longInput;
+  for (std::size_t i{0}; i < 2 * StreamPipeline::CHUNK_SIZE + 5; ++i) {
+    longInput += i % 3 == 0 ? 'b' : 'a';
+  }
+  const std::vector<std::string> INPUTS{"ab", longInput, "", "ba" + longInput, "abb", longInput + "a"};
+  std::string expected;
+  std::string lines;
+  std::string prefixed;
+  for (std::size_t i{0}; i < INPUTS.size(); ++i) {
+    expected += "accepted\t" + std::to_string(dtm.Run(INPUTS[i], RunLimits{}).steps) + "\n";
+    lines += INPUTS[i] + (i + 1 < INPUTS.size() ? "\n" : "");
+    prefixed += std::to_string(INPUTS[i].size()) + ":" + INPUTS[i];
+  }
+  bool passed{true};
+  for (const std::pair<StreamFormat, std::string>& FORMAT : {std::pair<StreamFormat, std::string>{StreamFormat::LINES, lines}, {StreamFormat::LENGTH_PREFIXED, prefixed}}) {
+    StreamOptions options;
+    options.format = FORMAT.first;
+    const bool FORMAT_PASSED{RunStream(dtm, options, FORMAT.second) == expected};
+    std::cout << (FORMAT_PASSED ? "PASS" : "FAIL") << " format " << (FORMAT.first == StreamFormat::LINES ? "lines" : "length-prefixed") << ": the inputs longer than a chunk "
+              << (FORMAT_PASSED ? "get" : "do not get") << " the results of running them on their own\n";
+    passed = passed && FORMAT_PASSED;
+  }
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}